@@ -0,0 +1,606 @@
+/* bench -- throughput of the tokenizer, and of some recognizers.
+ *
+ *    ./bench [-s MB] [-r REPEAT] [-m MAXLEN] [-l LEXICON] [-o ejci]
+ *            [-H m|f] [-f] [-L WINDOW] [-P] [CORPUS...]
+ *    ./bench -a [-s MB] [-r REPEAT] [-m MAXLEN] [ADVERSARIAL...]
+ *    ./bench [-a] -c CORPUS > corpus.txt
+ *
+ * every corpus (see corpus.c) is tokenized by both engines, as code
+ * points and as utf-8. the hardware counters (cycles, branch misses)
+ * are read with perf_event_open, when the kernel allows it (see
+ * /proc/sys/kernel/perf_event_paranoid).
+ *
+ * with -l, the lexicon is loaded from a file (tools/mklexicon.c), to
+ * compare it with the lexicon compiled in the library.
+ *
+ * with -o, only some tokens are recognized (OPT_*: emoticons, emojis,
+ * citekeys, inclusive suffixes), to compare the variants of the
+ * tokenizer (see src/token.c). `-o -` is OPT_NONE.
+ *
+ * with -H, the hashes of the tokens are computed too (both columns:
+ * the tokens and their lowercase form), with murmurhash (m) or fnv-1a
+ * (f), see src/hash.h. with -f, their shapes (SH_*, see src/parser.h).
+ *
+ * with -L, the texts are tokenized in the large-input mode (64-bit
+ * positions, see src/large.h), with windows of WINDOW code units (or
+ * bytes), to measure its cost. with -P, they are padded (JUSQUCI_PAD,
+ * see `pst->padded`): the loops of the tokenizer stop on the padding,
+ * without checking the end of the string.
+ *
+ * with -a, the adversarial texts are tokenized at 1/8, 1/4, 1/2 and
+ * the whole of the size: the time per byte must not grow with the
+ * size (the last column is the ratio of the last and the first).
+ */
+
+#include "../src/affixes.h"
+#include "../src/large.h"
+#include "../src/lexicon.h"
+#include "../src/parser.h"
+#include "../src/punct.h"
+#include "corpus.h"
+#include <linux/perf_event.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+#define N_TOKENS 4096
+
+/* not in a header: used by get_token only */
+int
+parse_digit(TParser* pst);
+
+/* maximum length of the tokens (-m), 0 for none */
+static int maxlen = 0;
+
+/* the normalized forms (-n: NORM_*), written during the tokenization */
+static int norm = 0;
+
+/* the options of the tokenizer (-o: OPT_*) */
+static int opts = OPT_ALL;
+
+/* the hash function of the tokens (-H: HASH_*), -1 for none */
+static int hash = -1;
+
+/* the shapes of the tokens (-f: SH_*) */
+static int shape = 0;
+
+/* the length of the windows of the large-input mode (-L), 0 for none */
+static int window = 0;
+
+/* padded texts (-P) */
+static int padded = 0;
+
+/* the lexicon (-l) */
+static TLexicon lexicon_file;
+static const TLexicon* lexicon = &lexicon_builtin;
+
+/* hardware counters */
+enum
+{
+  Cnt_Cycles = 0,
+  Cnt_Instructions,
+  Cnt_BranchMisses,
+  N_COUNTERS,
+};
+
+static int counters[N_COUNTERS] = { -1, -1, -1 };
+
+typedef struct
+{
+  double seconds;
+  long long count[N_COUNTERS]; /* -1 if not available */
+} measure;
+
+static int
+open_counter(unsigned long long config)
+{
+  struct perf_event_attr attr;
+
+  memset(&attr, 0, sizeof(attr));
+  attr.type = PERF_TYPE_HARDWARE;
+  attr.size = sizeof(attr);
+  attr.config = config;
+  attr.disabled = 1;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+
+  return (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+}
+
+static void
+open_counters(void)
+{
+  counters[Cnt_Cycles] = open_counter(PERF_COUNT_HW_CPU_CYCLES);
+  counters[Cnt_Instructions] = open_counter(PERF_COUNT_HW_INSTRUCTIONS);
+  counters[Cnt_BranchMisses] = open_counter(PERF_COUNT_HW_BRANCH_MISSES);
+}
+
+static double
+now(void)
+{
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return (double)t.tv_sec + (double)t.tv_nsec * 1e-9;
+}
+
+static void
+start_measure(measure* m)
+{
+  for (int i = 0; i < N_COUNTERS; i++) {
+    if (counters[i] >= 0) {
+      ioctl(counters[i], PERF_EVENT_IOC_RESET, 0);
+      ioctl(counters[i], PERF_EVENT_IOC_ENABLE, 0);
+    }
+  }
+  m->seconds = now();
+}
+
+static void
+stop_measure(measure* m)
+{
+  m->seconds = now() - m->seconds;
+  for (int i = 0; i < N_COUNTERS; i++) {
+    m->count[i] = -1;
+    if (counters[i] >= 0) {
+      ioctl(counters[i], PERF_EVENT_IOC_DISABLE, 0);
+      if (read(counters[i], &m->count[i], sizeof(long long)) !=
+          sizeof(long long))
+        m->count[i] = -1;
+    }
+  }
+}
+
+/* the best of several runs */
+static void
+keep_best(measure* best, const measure* m)
+{
+  if (best->seconds <= 0 || m->seconds < best->seconds)
+    *best = *m;
+}
+
+static void
+print_count(long long count, long long n)
+{
+  if (count < 0)
+    printf(" %10s", "-");
+  else
+    printf(" %10.2f", (double)count / (double)n);
+}
+
+/* tokenize a whole text, as code points or as utf-8 */
+static long long
+tokenize(jchar* str, int len, char* str8, int len8, int engine)
+{
+  static uint32_t start[N_TOKENS], length[N_TOKENS];
+  static uint8_t type[N_TOKENS], flags[N_TOKENS];
+  static uint64_t hashes[N_TOKENS], lhashes[N_TOKENS];
+  static uint8_t shapes[N_TOKENS];
+  TTokens tokens = { start, length, type, flags, hash >= 0 ? hashes : NULL,
+                     hash >= 0 ? lhashes : NULL, shape ? shapes : NULL };
+  static uint32_t norm_start[N_TOKENS], norm_len[N_TOKENS];
+  TNorms norms = { norm, NULL, 0, 0, norm_start, norm_len };
+  TLarge large;
+  TParser* pst = &large.pst;
+  long long n = 0;
+  int k;
+
+  /* the arena is reused for each batch: twice the text is enough. */
+  if (norm) {
+    norms.size = 2 * (str ? len : len8);
+    norms.buf = malloc(str ? sizeof(jchar) * (size_t)norms.size
+                           : (size_t)norms.size);
+    if (!norms.buf) {
+      fputs("bench: memory error.\n", stderr);
+      exit(1);
+    }
+  }
+
+  /* without -L, only the parser of `large` is used */
+  if (window) {
+    if (str)
+      init_large(&large, str, len);
+    else
+      init_large_utf8(&large, str8, len8);
+    large.window = window;
+  } else {
+    if (str)
+      init_parser(pst, str, len);
+    else
+      init_parser_utf8(pst, str8, len8);
+    pst->padded = padded;
+  }
+  pst->engine = engine;
+  pst->opts = opts;
+  if (hash >= 0)
+    pst->hash = hash;
+  pst->maxlen = maxlen;
+  pst->lexicon = lexicon;
+
+  /* the tests are done once per batch of tokens */
+  do {
+    norms.used = 0;
+    if (window)
+      k = get_large_tokens(&large, &tokens, norm ? &norms : NULL, N_TOKENS);
+    else if (norm)
+      k = str ? get_tokens_norm(pst, &tokens, &norms, N_TOKENS)
+              : get_tokens_norm_utf8(pst, &tokens, &norms, N_TOKENS);
+    else
+      k = str ? get_tokens(pst, &tokens, N_TOKENS)
+              : get_tokens_utf8(pst, &tokens, N_TOKENS);
+    n += k;
+  } while (k);
+
+  free(norms.buf);
+  return n;
+}
+
+/* decode utf-8 (the corpora are valid) */
+static int
+decode(const char* s8, jchar* out)
+{
+  const unsigned char* s = (const unsigned char*)s8;
+  int len = 0;
+
+  while (*s) {
+    if (*s < 0x80) {
+      out[len++] = *s++;
+    } else if (*s < 0xe0) {
+      out[len++] = (jchar)((s[0] & 0x1f) << 6 | (s[1] & 0x3f));
+      s += 2;
+    } else if (*s < 0xf0) {
+      out[len++] =
+        (jchar)((s[0] & 0x0f) << 12 | (s[1] & 0x3f) << 6 | (s[2] & 0x3f));
+      s += 3;
+    } else {
+      out[len++] = (jchar)((s[0] & 0x07) << 18 | (s[1] & 0x3f) << 12 |
+                           (s[2] & 0x3f) << 6 | (s[3] & 0x3f));
+      s += 4;
+    }
+  }
+
+  return len;
+}
+
+static const char* const engines[] = { "switch", "dfa" };
+
+/* the padding of a utf-8 text (see -P) */
+static char*
+pad_text(char* str8)
+{
+  size_t len8 = str8 ? strlen(str8) : 0;
+  char* s = str8 ? realloc(str8, len8 + JUSQUCI_PAD) : NULL;
+
+  if (!s) {
+    fputs("bench: memory error.\n", stderr);
+    exit(1);
+  }
+
+  memset(s + len8, 0, JUSQUCI_PAD);
+  return s;
+}
+
+/* the same text, as code points (padded too) */
+static jchar*
+decode_text(char* str8, int* len)
+{
+  jchar* str =
+    str8 ? calloc(strlen(str8) + JUSQUCI_PAD, sizeof(jchar)) : NULL;
+
+  if (!str) {
+    fputs("bench: memory error.\n", stderr);
+    exit(1);
+  }
+
+  *len = decode(str8, str);
+  return str;
+}
+
+static void
+bench_corpus(int kind, size_t size, int repeat)
+{
+  char* str8 = pad_text(make_corpus(kind, size));
+  int len;
+  jchar* str = decode_text(str8, &len);
+  int len8 = (int)strlen(str8);
+
+  for (int utf8 = 0; utf8 < 2; utf8++) {
+    for (int engine = 0; engine < 2; engine++) {
+      measure best = { 0 };
+      measure m;
+      long long n = 0;
+
+      for (int r = 0; r < repeat; r++) {
+        start_measure(&m);
+        n = utf8 ? tokenize(NULL, 0, str8, len8, engine)
+                 : tokenize(str, len, NULL, 0, engine);
+        stop_measure(&m);
+        keep_best(&best, &m);
+      }
+
+      printf("%-10s %-6s %-6s %8.1f %8.2f %8.2f",
+             corpus_names[kind],
+             utf8 ? "utf8" : "ucs4",
+             engines[engine],
+             (double)len8 / best.seconds / 1e6,
+             (double)n / best.seconds / 1e6,
+             best.seconds * 1e9 / (double)n);
+      print_count(best.count[Cnt_Cycles], n);
+      print_count(best.count[Cnt_Instructions], n);
+      print_count(best.count[Cnt_BranchMisses], n);
+      printf("\n");
+    }
+  }
+
+  free(str);
+  free(str8);
+}
+
+#define N_SCALES 4
+
+static void
+bench_scaling(int kind, size_t size, int repeat)
+{
+  char* str8[N_SCALES];
+  jchar* str[N_SCALES];
+  int len8[N_SCALES];
+  int len[N_SCALES];
+
+  for (int s = 0; s < N_SCALES; s++) {
+    str8[s] = pad_text(make_adversarial(kind, size >> (N_SCALES - 1 - s)));
+    str[s] = decode_text(str8[s], &len[s]);
+    len8[s] = (int)strlen(str8[s]);
+  }
+
+  for (int utf8 = 0; utf8 < 2; utf8++) {
+    for (int engine = 0; engine < 2; engine++) {
+      double ns[N_SCALES];
+
+      printf("%-10s %-6s %-6s", adversarial_names[kind],
+             utf8 ? "utf8" : "ucs4", engines[engine]);
+
+      for (int s = 0; s < N_SCALES; s++) {
+        double best = 0;
+
+        for (int r = 0; r < repeat; r++) {
+          double t = now();
+          if (utf8)
+            tokenize(NULL, 0, str8[s], len8[s], engine);
+          else
+            tokenize(str[s], len[s], NULL, 0, engine);
+          t = now() - t;
+          if (best <= 0 || t < best)
+            best = t;
+        }
+
+        ns[s] = best * 1e9 / (double)len8[s];
+        printf(" %8.2f", ns[s]);
+      }
+
+      printf(" %8.2f\n", ns[N_SCALES - 1] / ns[0]);
+    }
+  }
+
+  for (int s = 0; s < N_SCALES; s++) {
+    free(str[s]);
+    free(str8[s]);
+  }
+}
+
+/* recognizers: each one is called on a set of short strings, from the
+ * position where `get_token` would call it. */
+typedef struct
+{
+  const char* name;
+  const char* const* inputs; /* a '|' marks the position */
+  int n_inputs;
+  int (*call)(TParser* pst);
+} recognizer;
+
+static int
+call_incl_suff(TParser* pst)
+{
+  return is_incl_suff(pst, '.');
+}
+
+static int
+call_side_emoticon(TParser* pst)
+{
+  return is_side_emoticon(pst, 1);
+}
+
+static const char* const in_incl_suff[] = {
+  "auteur|.rice.s", "lecteur|.ice", "étudiant|.e.s", "mais|.maintenant",
+  "humain|.e.s", "acteur|.rice.x.s", "fin|.", "p|. ex",
+};
+
+static const char* const in_inversion[] = {
+  "penses|-tu", "dit|-il", "va-t|-on", "vaison|-la-romaine", "peut|-être",
+  "celle|-ci", "entends|-les", "est|-ce",
+};
+
+static const char* const in_digit[] = {
+  "|1789", "|12ème", "|3.14", "|10k", "|1er", "|2024-10-17", "|17e",
+  "|100000",
+};
+
+static const char* const in_side_emoticon[] = {
+  "|:-)", "|:)", "|;p", "|: ", "|:x", "|;-D", "|:(", "|:pour",
+};
+
+static const recognizer recognizers[] = {
+  { "is_incl_suff", in_incl_suff, 8, call_incl_suff },
+  { "is_inversion", in_inversion, 8, is_inversion },
+  { "parse_digit", in_digit, 8, parse_digit },
+  { "is_side_emoticon", in_side_emoticon, 8, call_side_emoticon },
+};
+
+static void
+bench_recognizer(const recognizer* rec, long long calls, int repeat)
+{
+  TParser pst[8];
+  jchar str[8][64];
+  int pos[8];
+  measure best = { 0 };
+  measure m;
+  volatile int sink = 0;
+
+  for (int i = 0; i < rec->n_inputs; i++) {
+    char before[64], whole[64];
+    const char* bar = strchr(rec->inputs[i], '|');
+
+    /* the position is the number of characters before the '|' */
+    snprintf(before, sizeof(before), "%.*s",
+             (int)(bar - rec->inputs[i]), rec->inputs[i]);
+    snprintf(whole, sizeof(whole), "%s%s", before, bar + 1);
+    pos[i] = decode(before, str[i]);
+    init_parser(&pst[i], str[i], decode(whole, str[i]));
+    pst[i].lexicon = lexicon;
+  }
+
+  for (int r = 0; r < repeat; r++) {
+    start_measure(&m);
+    for (long long k = 0; k < calls; k++) {
+      TParser* p = &pst[k % rec->n_inputs];
+      p->pos = p->tidx = pos[k % rec->n_inputs];
+      sink += rec->call(p);
+    }
+    stop_measure(&m);
+    keep_best(&best, &m);
+  }
+
+  printf("%-24s %8.2f", rec->name, best.seconds * 1e9 / (double)calls);
+  print_count(best.count[Cnt_Cycles], calls);
+  print_count(best.count[Cnt_Instructions], calls);
+  print_count(best.count[Cnt_BranchMisses], calls);
+  printf("\n");
+}
+
+int
+main(int argc, char** argv)
+{
+  size_t size = 4;
+  int repeat = 5;
+  int kinds[N_CORPUS + N_ADVERSARIAL];
+  int n_kinds = 0;
+  int adversarial = 0;
+  int opt;
+
+  while ((opt = getopt(argc, argv, "s:r:m:l:no:H:fL:Pac:")) != -1) {
+    switch (opt) {
+      case 's':
+        size = (size_t)atol(optarg);
+        break;
+      case 'r':
+        repeat = atoi(optarg);
+        break;
+      case 'm':
+        maxlen = atoi(optarg);
+        break;
+      case 'l':
+        if (load_lexicon(&lexicon_file, optarg)) {
+          fprintf(stderr, "bench: cannot load the lexicon %s.\n", optarg);
+          return 1;
+        }
+        lexicon = &lexicon_file;
+        break;
+      case 'n':
+        norm = NORM_LOWER | NORM_UNACCENT;
+        break;
+      case 'o':
+        opts = (strchr(optarg, 'e') ? OPT_EMOTICONS : 0) |
+               (strchr(optarg, 'j') ? OPT_EMOJIS : 0) |
+               (strchr(optarg, 'c') ? OPT_CITEKEYS : 0) |
+               (strchr(optarg, 'i') ? OPT_INCLUSIVE : 0);
+        break;
+      case 'H':
+        hash = strchr(optarg, 'f') ? HASH_FNV : HASH_MURMUR;
+        break;
+      case 'f':
+        shape = 1;
+        break;
+      case 'L':
+        window = atoi(optarg);
+        break;
+      case 'P':
+        padded = 1;
+        break;
+      case 'a':
+        adversarial = 1;
+        break;
+      case 'c': {
+        /* write a corpus (after -a: an adversarial text) */
+        int kind = adversarial ? adversarial_kind(optarg)
+                               : corpus_kind(optarg);
+        char* s = kind < 0              ? NULL
+                  : adversarial ? make_adversarial(kind, size << 20)
+                                : make_corpus(kind, size << 20);
+        if (!s) {
+          fprintf(stderr, "bench: unknown corpus %s.\n", optarg);
+          return 1;
+        }
+        fputs(s, stdout);
+        free(s);
+        return 0;
+      }
+      default:
+        fputs("usage: bench [-s MB] [-r REPEAT] [-m MAXLEN] [-l LEXICON] "
+              "[-n] [-o ejci] [-H m|f] [-f] [-L WINDOW]\n"
+              "             [-P] [CORPUS...]\n"
+              "       bench -a [-s MB] [-r REPEAT] [-m MAXLEN] "
+              "[ADVERSARIAL...]\n"
+              "       bench [-s MB] [-a] -c CORPUS\n",
+              stderr);
+        return 1;
+    }
+  }
+
+  for (int i = optind; i < argc && n_kinds < N_CORPUS + N_ADVERSARIAL;
+       i++) {
+    kinds[n_kinds] = adversarial ? adversarial_kind(argv[i])
+                                 : corpus_kind(argv[i]);
+    if (kinds[n_kinds] < 0) {
+      fprintf(stderr, "bench: unknown corpus %s.\n", argv[i]);
+      return 1;
+    }
+    n_kinds++;
+  }
+  if (!n_kinds) {
+    for (int i = 0; i < (adversarial ? N_ADVERSARIAL : N_CORPUS); i++)
+      kinds[n_kinds++] = i;
+  }
+
+  if (adversarial) {
+    printf("%-10s %-6s %-6s", "text", "input", "engine");
+    for (int s = 0; s < N_SCALES; s++) {
+      char col[16];
+      snprintf(col, sizeof(col), "ns/B %.1f", (double)size /
+                                              (double)(1 << (N_SCALES - 1 - s)));
+      printf(" %8s", col);
+    }
+    printf(" %8s\n", "growth");
+    for (int i = 0; i < n_kinds; i++)
+      bench_scaling(kinds[i], size << 20, repeat);
+    return 0;
+  }
+
+  open_counters();
+  if (counters[Cnt_Cycles] < 0)
+    fputs("(hardware counters not available.)\n", stderr);
+
+  printf("%-10s %-6s %-6s %8s %8s %8s %10s %10s %10s\n",
+         "corpus", "input", "engine", "MB/s", "Mtok/s", "ns/tok",
+         "cycles/tok", "instr/tok", "brmiss/tok");
+  for (int i = 0; i < n_kinds; i++)
+    bench_corpus(kinds[i], size << 20, repeat);
+
+  printf("\n%-24s %8s %10s %10s %10s\n",
+         "recognizer", "ns/call", "cycles", "instr", "brmiss");
+  for (size_t i = 0; i < sizeof(recognizers) / sizeof(recognizers[0]); i++)
+    bench_recognizer(&recognizers[i], 1000000, repeat);
+
+  return 0;
+}
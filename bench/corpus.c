@@ -0,0 +1,313 @@
+/* corpus -- reproducible texts for the benchmarks.
+ *
+ * the texts are made of sentences drawn from small lists of words,
+ * with a fixed pseudo-random generator (xorshift), so they are the
+ * same on every machine.
+ */
+
+#include "corpus.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define N(a) (sizeof(a) / sizeof(a[0]))
+
+const char* const corpus_names[N_CORPUS] = {
+  "prose", "inclusive", "academic", "social", "tables",
+};
+
+static const char* const words[] = {
+  "le", "la", "les", "un", "une", "des", "et", "ou", "mais", "donc",
+  "de", "du", "dans", "pour", "avec", "sans", "sur", "sous", "entre",
+  "il", "elle", "nous", "vous", "ils", "on", "qui", "que", "dont",
+  "est", "sont", "était", "avait", "fait", "dit", "peut", "faut",
+  "temps", "monde", "homme", "femme", "ville", "maison", "rue", "nuit",
+  "jour", "année", "histoire", "pratique", "quotidien", "manière",
+  "braconner", "inventer", "lire", "écrire", "marcher", "habiter",
+  "très", "plus", "moins", "toujours", "jamais", "déjà", "encore",
+  "être", "avoir", "ça", "cela", "où", "là", "ici", "après", "avant",
+  "Paris", "Marseille", "Vaison-la-Romaine", "français", "été",
+  "œuvre", "cœur", "garçon", "leçon", "Éric", "À", "Ô", "hiver",
+  "heure", "hier", "ville", "wagon", "xylophone", "vie", "voir",
+};
+
+static const char* const elided[] = {
+  "l'", "d'", "j'", "qu'", "jusqu'", "n'", "s'", "c'", "l’", "d’",
+};
+
+static const char* const compounds[] = {
+  "peut-être", "dit-il", "penses-tu", "est-ce", "va-t-on", "celle-ci",
+  "au-delà", "c'est-à-dire", "vis-à-vis", "entends-les",
+};
+
+static const char* const abbrevs[] = {
+  "p. ex.", "etc.", "M.", "Mme.", "cf.", "n° 47", "av. J.-C.",
+};
+
+static const char* const inclusive[] = {
+  "auteur·rice·s", "lecteur.ice.s", "étudiant.e.s", "enseignant·e",
+  "chercheur-euse-s", "ami·e·s", "acteur.rice.x.s", "autre(s)",
+  "celleux", "iels", "toustes", "correcteur·rices", "humain.e.s",
+  "[re]lecteur.rice.s", "travailleur·euse", "(socio)linguiste",
+};
+
+static const char* const academic[] = {
+  "https://www.persee.fr/doc/ahess_0395-2649_1990_num_45_6_278917",
+  "www.on-tenk.com", "http://exemple.org/a?b=c&d=e",
+  "[@becker_1982, p. 12]", "@certeau1980", "[@latour_2006; @law_2004]",
+  "(ibid., p. 45)", "(1980, 2e éd.)", "vol. 3", "pp. 17-42",
+  "doi:10.3406/ahess.1990.278917", "(socio)anthropologique",
+};
+
+static const char* const social[] = {
+  ":)", ":-)", ":D", "xD", "XD", "^^", "=)", ";p", ":-(", "o.O",
+  "ô.ô", "x_x", ":happy:", ":joie:", "<3", "->", "==>", "!!!", "?!",
+  "...", "lol", "mdr", "(:", "--->", "T_T", ":((", "!!?",
+};
+
+static const char* const units[] = {
+  "km", "kg", "%", "€", "h", "m²", "°C", "ms",
+};
+
+static const char* const ordinals[] = {
+  "1er", "1ère", "2e", "3ème", "17ème", "XXe", "21e", "2nd", "4èmes",
+};
+
+static uint32_t rng;
+
+static uint32_t
+next_rand(void)
+{
+  rng ^= rng << 13;
+  rng ^= rng >> 17;
+  rng ^= rng << 5;
+  return rng;
+}
+
+static const char*
+pick(const char* const* list, size_t n)
+{
+  return list[next_rand() % n];
+}
+
+static int
+chance(int percent)
+{
+  return (int)(next_rand() % 100) < percent;
+}
+
+typedef struct
+{
+  char* buf;
+  size_t len;
+  size_t size;
+} text;
+
+static void
+put(text* t, const char* s)
+{
+  size_t n = strlen(s);
+
+  if (t->len + n < t->size) {
+    memcpy(t->buf + t->len, s, n);
+    t->len += n;
+  }
+}
+
+static void
+put_number(text* t, uint32_t max)
+{
+  char num[16];
+  int i = (int)sizeof(num) - 1;
+  uint32_t x = next_rand() % max;
+
+  num[i] = '\0';
+  do {
+    num[--i] = (char)('0' + x % 10);
+    x /= 10;
+  } while (x);
+  put(t, &num[i]);
+}
+
+/* a word of the kind of text */
+static void
+put_word(text* t, int kind)
+{
+  switch (kind) {
+    case Corpus_Inclusive:
+      if (chance(25)) {
+        put(t, pick(inclusive, N(inclusive)));
+        return;
+      }
+      break;
+    case Corpus_Academic:
+      if (chance(10)) {
+        put(t, pick(academic, N(academic)));
+        return;
+      }
+      if (chance(5)) {
+        put_number(t, 2030);
+        return;
+      }
+      break;
+    case Corpus_Social:
+      if (chance(15)) {
+        put(t, pick(social, N(social)));
+        return;
+      }
+      break;
+    case Corpus_Tables:
+      if (chance(50)) {
+        put_number(t, 100000);
+        if (chance(20)) {
+          put(t, ",");
+          put_number(t, 100);
+        }
+        if (chance(20)) {
+          put(t, " ");
+          put(t, pick(units, N(units)));
+        }
+        return;
+      }
+      if (chance(10)) {
+        put(t, pick(ordinals, N(ordinals)));
+        return;
+      }
+      if (chance(5)) {
+        put_number(t, 2030);
+        put(t, "-");
+        put_number(t, 12);
+        put(t, "-");
+        put_number(t, 31);
+        return;
+      }
+      break;
+  }
+
+  if (chance(5))
+    put(t, pick(compounds, N(compounds)));
+  else if (chance(2))
+    put(t, pick(abbrevs, N(abbrevs)));
+  else {
+    if (chance(8))
+      put(t, pick(elided, N(elided)));
+    put(t, pick(words, N(words)));
+  }
+}
+
+static void
+put_sentence(text* t, int kind)
+{
+  int n = 4 + (int)(next_rand() % 16);
+
+  for (int i = 0; i < n; i++) {
+    put_word(t, kind);
+
+    if (i == n - 1)
+      break;
+
+    if (kind == Corpus_Tables && chance(30))
+      put(t, chance(50) ? "\t" : " | ");
+    else if (chance(8))
+      put(t, ", ");
+    else if (chance(2))
+      put(t, " ; ");
+    else if (chance(2))
+      put(t, " : ");
+    else
+      put(t, " ");
+  }
+
+  if (kind == Corpus_Social && chance(30))
+    put(t, pick(social, N(social)));
+  else if (chance(10))
+    put(t, "?");
+  else if (chance(5))
+    put(t, "!");
+  else if (chance(3))
+    put(t, "...");
+  else
+    put(t, ".");
+}
+
+char*
+make_corpus(int kind, size_t size)
+{
+  text t;
+
+  t.size = size + 1;
+  t.len = 0;
+  t.buf = malloc(t.size);
+  if (!t.buf)
+    return NULL;
+
+  rng = 2463534242u + (uint32_t)kind;
+
+  /* leave space for the longest sentence (and the '\0') */
+  while (t.len + 4096 < t.size) {
+    put_sentence(&t, kind);
+    put(&t, chance(20) ? "\n" : " ");
+  }
+
+  t.buf[t.len] = '\0';
+  return t.buf;
+}
+
+int
+corpus_kind(const char* name)
+{
+  for (int i = 0; i < N_CORPUS; i++) {
+    if (!strcmp(name, corpus_names[i]))
+      return i;
+  }
+  return -1;
+}
+
+const char* const adversarial_names[N_ADVERSARIAL] = {
+  "parens", "colons", "hyphens", "dots", "intrapar",
+  "emoji", "arrow", "url", "blob",
+};
+
+/* the repeated patterns (the blob is random) */
+static const char* const patterns[N_ADVERSARIAL] = {
+  "(", ":", "a-", ".e", "(a-", ":a", "-", "a/", NULL,
+};
+
+/* the characters of the blob: the ones that start a lookahead */
+static const char* const blob[] = {
+  "a", "e", "é", "x", "h", "w", "(", ")", "[", "]", "-", ".", "·",
+  ":", ";", "'", "’", "/", "@", "_", "1", "^", "<", ">", "=", "!",
+};
+
+char*
+make_adversarial(int kind, size_t size)
+{
+  text t;
+
+  t.size = size + 1;
+  t.len = 0;
+  t.buf = malloc(t.size);
+  if (!t.buf)
+    return NULL;
+
+  rng = 2463534242u + (uint32_t)kind;
+
+  if (kind == Adv_Url)
+    put(&t, "http://");
+
+  while (t.len + 8 < t.size)
+    put(&t, patterns[kind] ? patterns[kind] : pick(blob, N(blob)));
+
+  t.buf[t.len] = '\0';
+  return t.buf;
+}
+
+int
+adversarial_kind(const char* name)
+{
+  for (int i = 0; i < N_ADVERSARIAL; i++) {
+    if (!strcmp(name, adversarial_names[i]))
+      return i;
+  }
+  return -1;
+}
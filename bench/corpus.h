@@ -0,0 +1,56 @@
+#ifndef CORPUS_H
+#define CORPUS_H
+
+#include <stddef.h>
+
+/* kinds of texts */
+enum CorpusKind
+{
+  Corpus_Prose = 0, /* plain french prose */
+  Corpus_Inclusive, /* inclusive writing: auteur·rice·s, lecteur.ice.s */
+  Corpus_Academic,  /* urls, citekeys, references, numbers */
+  Corpus_Social,    /* emoticons, emojis, repeated punctuation */
+  Corpus_Tables,    /* digits, dates, ordinals, units */
+  N_CORPUS,
+};
+
+extern const char* const corpus_names[N_CORPUS];
+
+/* make a text of about `size` bytes (utf-8, \0 terminated). the same
+ * kind and size always give the same text. returns NULL if memory
+ * can't be allocated. */
+char*
+make_corpus(int kind, size_t size);
+
+/* the kind from its name, or -1 */
+int
+corpus_kind(const char* name);
+
+/* adversarial texts: a pattern repeated, without any space, to check
+ * that the time of the tokenization is linear. */
+enum AdversarialKind
+{
+  Adv_Parens = 0, /* ((((((( */
+  Adv_Colons,     /* ::::::: */
+  Adv_Hyphens,    /* a-a-a-a */
+  Adv_Dots,       /* .e.e.e.e */
+  Adv_Intrapar,   /* (a-(a-(a- */
+  Adv_Emoji,      /* :a:a:a */
+  Adv_Arrow,      /* ------- */
+  Adv_Url,        /* http://a/a/a/a */
+  Adv_Blob,       /* random letters and signs */
+  N_ADVERSARIAL,
+};
+
+extern const char* const adversarial_names[N_ADVERSARIAL];
+
+/* make an adversarial text of about `size` bytes (the same for the same
+ * kind and size), or NULL. */
+char*
+make_adversarial(int kind, size_t size);
+
+/* the kind from its name, or -1 */
+int
+adversarial_kind(const char* name);
+
+#endif
@@ -1,90 +1,272 @@
+#include "../src/lexicon.h"
 #include "../src/parser.h"
+#include "../src/stats.h"
+#include "../src/stream.h"
+#include "../src/terms.h"
 #include <wctype.h>
 #include <wchar.h>
 #include <locale.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
 
-#define BASE_SIZE 256
+#define CHUNK_SIZE 4096
+#define N_TOKENS 256
 
-void
-tokenize_print(TParser* pst, jchar* text, int len)
-{
-  // init or re-init parser
-  init_parser(pst, text, len);
+// nothing has been printed on the line yet
+static int empty_line = 1;
 
-  int ttype = TS_START;
+// the normalized forms (-n), written by the parser
+static uint32_t norm_start[N_TOKENS], norm_len[N_TOKENS];
+static TNorms norms = { 0, NULL, 0, 0, norm_start, norm_len };
 
-  do {
-    // get next token
-    ttype = get_token(pst);
+// only print the index terms (-t)
+static int terms = 0;
 
-    // only print words
-    if (ttype != TS_SPACE && ttype != TS_END) {
+// print the hashes of the tokens instead (-H): 0 for none, 1 for the
+// tokens, 2 for their lowercase form
+static int hashes = 0;
 
-      // iterate over the chars of the token
-      for (int c = 0; c < pst->tlen; c++)
-        putwchar((wchar_t)pst->str[pst->tidx + c]);
+int
+print_tokens(TStream* st)
+{
+  // tokens are parsed by batches
+  static uint32_t start[N_TOKENS], length[N_TOKENS];
+  static uint8_t type[N_TOKENS], flags[N_TOKENS];
+  static uint64_t hash[N_TOKENS];
+  TTokens tokens = { start, length, type, flags, hashes == 1 ? hash : NULL,
+                     hashes == 2 ? hash : NULL, NULL };
+  int n;
 
-      putwchar(L' ');
+  // the arena is always large enough (twice the text in the buffer),
+  // and it's reused for each batch
+  if (st->norms && norms.size < 2 * st->len) {
+    size_t size = 2 * (size_t)st->len;
+    jchar* temp = realloc(norms.buf, sizeof(jchar) * size);
+    if (!temp) {
+      fputs("(memory error.)", stderr);
+      return 1;
+    }
+    norms.buf = temp;
+    norms.size = (int)size;
+  }
 
-      // add a newline after strong punctuation
-      if (ttype == TS_PUNCTSTRONG)
+  for (;;) {
+    norms.used = 0;
+    if (!(n = get_stream_tokens(st, &tokens, N_TOKENS)))
+      break;
+
+    // the terms are normalized forms (stemmed, without stopwords)
+    if (terms)
+      n = make_terms(&tokens, &norms, n);
+    for (int i = 0; i < n; i++) {
+
+      // a sentence starts on a new line (the terms are on the line
+      // of their text)
+      if ((flags[i] & TF_SENTSTART) && !empty_line && !terms)
         putwchar(L'\n');
+      empty_line = 0;
+
+      // iterate over the chars of the token (or of its normalized form)
+      if (hashes) {
+        wprintf(L"%llu", (unsigned long long)hash[i]);
+      } else if (st->norms) {
+        jchar* norm = (jchar*)norms.buf + norm_start[i];
+        for (uint32_t c = 0; c < norm_len[i]; c++)
+          putwchar((wchar_t)norm[c]);
+      } else {
+        for (uint32_t c = 0; c < length[i]; c++)
+          putwchar((wchar_t)st->buf[start[i] + c]);
+      }
+
+      putwchar(L' ');
     }
+  }
+
+  return 0;
+}
+
+// the options of the tokenizer (-o): emoticons (e), emojis (j),
+// citekeys (c), inclusive suffixes (i). any other letter for none.
+int
+read_opts(const char* s)
+{
+  int opts = OPT_NONE;
 
-  } while (ttype != TS_END);
+  if (strchr(s, 'e'))
+    opts |= OPT_EMOTICONS;
+  if (strchr(s, 'j'))
+    opts |= OPT_EMOJIS;
+  if (strchr(s, 'c'))
+    opts |= OPT_CITEKEYS;
+  if (strchr(s, 'i'))
+    opts |= OPT_INCLUSIVE;
 
-  // add a newline
-  putwchar(L'\n');
+  return opts;
 }
 
+// the hash function (-H): murmurhash (m) or fnv-1a (f), of the
+// lowercase tokens (l)
 int
-main(int argc, char** argv)
+read_hash(const char* s, int* lower)
 {
+  *lower = (strchr(s, 'l') != NULL);
+  return strchr(s, 'f') ? HASH_FNV : HASH_MURMUR;
+}
 
-  setlocale(LC_CTYPE, ""); // wide char support
+// the hot-path counters (-s), on stderr
+void
+print_stats(void)
+{
+  if (!stats_enabled()) {
+    fputs("jusquci: no counters (build with `make stats`).\n", stderr);
+    return;
+  }
 
-  TParser pst;
-  init_parser(&pst, NULL, 0);
-  wint_t c;
-  size_t index = 0;
+  for (int i = 0; i < N_STATS; i++)
+    fprintf(stderr, "%-26s %llu\n", jusquci_stats_names[i],
+            jusquci_stats[i]);
 
-  // allocate memory to read from stdin
-  size_t size = BASE_SIZE;
-  wchar_t* str = malloc(size * sizeof(wchar_t*));
-  if (!str)
+  // the characters read more than once
+  fprintf(stderr, "%-26s %llu\n", "chars.rescanned",
+          jusquci_stats[Stat_Reads] - jusquci_stats[Stat_Chars]);
+}
+
+int
+feed_print(TStream* st, jchar* chunk, int len)
+{
+  if (feed_stream(st, chunk, len)) {
+    fputs("(memory error.)", stderr);
     return 1;
+  }
+  return print_tokens(st);
+}
 
-  while ((c = getwchar()) != WEOF) {
+int
+main(int argc, char** argv)
+{
+
+  setlocale(LC_CTYPE, ""); // wide char input/output (not tokenization)
+
+  // lines are parsed by chunks, so long lines are not held in memory
+  TStream st = { 0 };
+  jchar chunk[CHUNK_SIZE];
+  wint_t c;
+  int index = 0;
+  int status = 0;
 
-    // reallocate memory if needed
-    while (index >= size) {
-      size *= 2;
-      wchar_t* temp = realloc(str, size * sizeof(wchar_t*));
-      if (!temp) {
-        fputs("(memory error.)", stderr);
-        free(str);
+  // -d: use the generated state machine (the tokens are the same)
+  // -m N: cut the tokens longer than N characters
+  // -l FILE: use a lexicon file (tools/mklexicon.c)
+  // -n lu: print the normalized forms: lowercase (l), unaccented (u)
+  // -t: print the index terms (src/terms.h)
+  // -s: print the hot-path counters on stderr (src/stats.h)
+  // -o ejci: only recognize these tokens (OPT_*, see read_opts)
+  // -H mfl: print the hashes of the tokens (see read_hash)
+  int engine = ENGINE_SWITCH;
+  int opts = OPT_ALL;
+  int maxlen = 0;
+  TLexicon lexicon = { 0 };
+  int stats = 0;
+  int hash = HASH_MURMUR;
+  int lower;
+  int opt;
+  while ((opt = getopt(argc, argv, "dm:l:n:tso:H:")) != -1) {
+    if (opt == 'd')
+      engine = ENGINE_DFA;
+    else if (opt == 'm')
+      maxlen = atoi(optarg);
+    else if (opt == 'n') {
+      if (strchr(optarg, 'l'))
+        norms.opts |= NORM_LOWER;
+      if (strchr(optarg, 'u'))
+        norms.opts |= NORM_UNACCENT;
+      st.norms = &norms;
+    } else if (opt == 't') {
+      terms = 1;
+      norms.opts |= NORM_LOWER;
+      st.norms = &norms;
+    } else if (opt == 's') {
+      stats = 1;
+    } else if (opt == 'o') {
+      opts = read_opts(optarg);
+    } else if (opt == 'H') {
+      hash = read_hash(optarg, &lower);
+      hashes = lower ? 2 : 1;
+    } else if (opt == 'l') {
+      if (load_lexicon(&lexicon, optarg)) {
+        fprintf(stderr, "jusquci: cannot load the lexicon %s.\n", optarg);
         return 1;
       }
-      str = temp;
+    } else {
+      fputs("usage: jusquci [-d] [-m MAXLEN] [-l LEXICON] [-n lu] [-t] "
+            "[-s] [-o ejci] [-H mfl]\n",
+            stderr);
+      return 1;
     }
+  }
+
+  // only print words: the simple spaces are skipped by the parser (and
+  // all but the words, for the terms)
+  unsigned int types = terms ? TERM_TYPES : TYPES_ALL & ~TYPE_BIT(TS_SPACE);
+
+  init_stream(&st);
+  st.pst.engine = engine;
+  st.pst.opts = opts;
+  st.pst.types = types;
+  st.pst.hash = hash;
+  st.pst.maxlen = maxlen;
+  if (lexicon.nodes)
+    st.pst.lexicon = &lexicon;
+
+  while ((c = getwchar()) != WEOF) {
 
     // parse newline per newline
     if (c == '\n') {
-      tokenize_print(&pst, (jchar*)str, (int)index);
+      if ((status = feed_print(&st, chunk, index)))
+        break;
+      finish_stream(&st);
+      if ((status = print_tokens(&st)))
+        break;
+      putwchar(L'\n');
+      empty_line = 1;
+      init_stream(&st);
+      st.pst.engine = engine;
+      st.pst.opts = opts;
+      st.pst.types = types;
+      st.pst.hash = hash;
+      st.pst.maxlen = maxlen;
+      if (lexicon.nodes)
+        st.pst.lexicon = &lexicon;
       index = 0;
       continue;
+    }
 
-      // add the character to the string
-    } else {
-      str[index] = (wchar_t)c;
-      index++;
+    // add the character to the chunk
+    chunk[index++] = (jchar)c;
+    if (index == CHUNK_SIZE) {
+      if ((status = feed_print(&st, chunk, index)))
+        break;
+      index = 0;
     }
   }
 
-  free(str);
-  // free_parser(&pst);
+  // last line, without newline
+  if (!status && (index || st.offset || st.len)) {
+    status = feed_print(&st, chunk, index);
+    finish_stream(&st);
+    if (!status)
+      status = print_tokens(&st);
+    putwchar(L'\n');
+  }
+
+  if (stats)
+    print_stats();
 
-  return 0;
+  free_stream(&st);
+  free(norms.buf);
+  free_lexicon(&lexicon);
+
+  return status;
 }
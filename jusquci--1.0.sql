@@ -25,6 +25,18 @@ CREATE OR REPLACE FUNCTION jusquci_parser_lextype (internal)
 LANGUAGE c
 STRICT IMMUTABLE;
 
+CREATE OR REPLACE FUNCTION jusquci_terms_init (internal)
+    RETURNS internal
+    AS 'MODULE_PATHNAME'
+LANGUAGE c
+STRICT;
+
+CREATE OR REPLACE FUNCTION jusquci_terms_lexize (internal, internal, internal, internal)
+    RETURNS internal
+    AS 'MODULE_PATHNAME'
+LANGUAGE c
+STRICT;
+
 DROP TEXT SEARCH PARSER IF EXISTS jusquci CASCADE;
 
 CREATE TEXT SEARCH PARSER jusquci (
@@ -47,3 +59,16 @@ CREATE TEXT SEARCH DICTIONARY jusquci (
 
 ALTER TEXT SEARCH CONFIGURATION jusquci
     ALTER MAPPING FOR word WITH french_stem;
+
+-- index terms: french stopwords and light stemming (src/terms.h), in
+-- a single call. option: unaccent = true.
+DROP TEXT SEARCH TEMPLATE IF EXISTS jusquci_terms CASCADE;
+
+CREATE TEXT SEARCH TEMPLATE jusquci_terms (
+    INIT = jusquci_terms_init,
+    LEXIZE = jusquci_terms_lexize
+);
+
+CREATE TEXT SEARCH DICTIONARY jusquci_terms (
+    TEMPLATE = jusquci_terms
+);
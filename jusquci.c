@@ -1,28 +1,94 @@
 #include "postgres.h"
 
+#include "src/lexicon.h"
 #include "src/parser.h"
+#include "src/probes.h"
+#include "src/terms.h"
 
+#include "commands/defrem.h"
 #include "fmgr.h"
 #include "tsearch/ts_public.h"
 #include "mb/pg_wchar.h"
+#include "utils/guc.h"
 
 PG_FUNCTION_INFO_V1(jusquci_parser_start);
 PG_FUNCTION_INFO_V1(jusquci_parser_end);
 PG_FUNCTION_INFO_V1(jusquci_parser_gettoken);
 PG_FUNCTION_INFO_V1(jusquci_parser_lextype);
+PG_FUNCTION_INFO_V1(jusquci_terms_init);
+PG_FUNCTION_INFO_V1(jusquci_terms_lexize);
 
 PG_MODULE_MAGIC;
 
+void _PG_init(void);
+
+// a lexicon file (tools/mklexicon.c), instead of the lexicon compiled
+// in the library. it's mapped (not read) once per backend: its pages
+// are shared between backends.
+static char* lexicon_path = NULL;
+static char* lexicon_loaded = NULL; // the path of `lexicon_file`
+static TLexicon lexicon_file;
+
+void
+_PG_init(void)
+{
+  DefineCustomStringVariable("jusquci.lexicon",
+    "Lexicon file (abbreviations, inversions, suffixes), "
+    "compiled by mklexicon.",
+    NULL,
+    &lexicon_path,
+    "",
+    PGC_SUSET,
+    0,
+    NULL,
+    NULL,
+    NULL);
+}
+
+// the parser, and the number of its tokens (for the probes, see
+// src/probes.h). postgresql only knows the parser: it's first.
+typedef struct
+{
+  TParser pst;
+  int ntokens;
+} PgParser;
+
+static const TLexicon*
+get_lexicon(void)
+{
+  if (!lexicon_path || !*lexicon_path)
+    return &lexicon_builtin;
+
+  // the setting has changed since the file was loaded
+  if (!lexicon_loaded || strcmp(lexicon_loaded, lexicon_path)) {
+    free_lexicon(&lexicon_file);
+    if (lexicon_loaded)
+      pfree(lexicon_loaded);
+    lexicon_loaded = NULL;
+
+    if (load_lexicon(&lexicon_file, lexicon_path))
+      ereport(ERROR,
+        (errcode(ERRCODE_CONFIG_FILE_ERROR),
+         errmsg("could not load the lexicon file \"%s\"", lexicon_path)));
+
+    lexicon_loaded = MemoryContextStrdup(TopMemoryContext, lexicon_path);
+  }
+
+  return &lexicon_file;
+}
+
 Datum
 jusquci_parser_start(PG_FUNCTION_ARGS)
 {
+  PgParser* state;
   TParser* pst;
   size_t len;
   char* _str;
   pg_wchar* str;
 
   // allocate memory for parser
-  pst = (TParser*)palloc0(sizeof(TParser));
+  state = (PgParser*)palloc0(sizeof(PgParser));
+  pst = &state->pst;
 
   // get pointer to the text
   _str = (char*)PG_GETARG_POINTER(0);
@@ -32,15 +98,27 @@ jusquci_parser_start(PG_FUNCTION_ARGS)
 
   // get the length of the text to parse
   len = (size_t)PG_GETARG_INT32(1);
+  PROBE_DOC_START(len);
 
-  // convert to wide char.
-  str = (pg_wchar*)palloc0(sizeof(pg_wchar*) * len);
+  // utf-8 text is parsed as it is, without conversion: positions
+  // and lengths are then in bytes.
+  if (GetDatabaseEncoding() == PG_UTF8) {
+    init_parser_utf8(pst, _str, (int)len);
+    pst->lexicon = get_lexicon();
+    PG_RETURN_POINTER(pst);
+  }
+
+  // convert to wide char, with the padding of the parser (there are
+  // never more characters than bytes).
+  str = (pg_wchar*)palloc0(sizeof(pg_wchar) * (len + JUSQUCI_PAD));
 
   // convert multbytes to wide char string, and get the length
   len = (size_t)pg_mb2wchar_with_len(_str, (pg_wchar*)str, (int)len);
 
   init_parser(pst, str, (int)len);
+  pst->padded = 1;
   pst->_str = _str;
+  pst->lexicon = get_lexicon();
 
   PG_RETURN_POINTER(pst);
 }
@@ -49,9 +127,13 @@ Datum
 jusquci_parser_end(PG_FUNCTION_ARGS)
 {
   // free memory allocated for parser and strings: there is nothing else to do
-  TParser* pst = (TParser*)PG_GETARG_POINTER(0);
-  pfree(pst->str);
-  pfree(pst);
+  PgParser* state = (PgParser*)PG_GETARG_POINTER(0);
+  TParser* pst = &state->pst;
+
+  PROBE_DOC_END(pst->strlen, state->ntokens);
+  if (pst->str)
+    pfree(pst->str);
+  pfree(state);
   PG_RETURN_VOID();
 }
 
@@ -59,7 +141,8 @@ Datum
 jusquci_parser_gettoken(PG_FUNCTION_ARGS)
 {
   // the text parser
-  TParser* pst = (TParser*)PG_GETARG_POINTER(0);
+  PgParser* state = (PgParser*)PG_GETARG_POINTER(0);
+  TParser* pst = &state->pst;
 
   // the pointers to store the token index and length
   char** t;
@@ -75,12 +158,13 @@ jusquci_parser_gettoken(PG_FUNCTION_ARGS)
   char* startpos;
 
   // get the next token type; its length and index are stored
-  // within the parser.
-  ttype = get_token(pst);
+  // within the parser. (no wide char string: it's utf-8.)
+  ttype = pst->str ? get_token(pst) : get_token_utf8(pst);
 
   // end of string, end of parsing
   if (ttype == TS_END)
     PG_RETURN_INT32(TS_END);
+  state->ntokens++;
 
   // get the pointer where to write the token start position
   t = (char**)PG_GETARG_POINTER(1);
@@ -88,6 +172,13 @@ jusquci_parser_gettoken(PG_FUNCTION_ARGS)
   // get the pointer where to write the token length
   tlen = (int*)PG_GETARG_POINTER(2);
 
+  // utf-8: index and length are already in bytes
+  if (!pst->str) {
+    *t = &pst->_str[pst->tidx];
+    *tlen = pst->tlen;
+    PG_RETURN_INT32(ttype);
+  }
+
   idx = pst->tidx + pst->_mb;
   len = pst->tlen;
 
@@ -168,3 +259,64 @@ jusquci_parser_lextype(PG_FUNCTION_ARGS)
   descr[TS_LASTNUM].lexid = 0;
   PG_RETURN_POINTER(descr);
 }
+
+// the dictionary of index terms (src/terms.h): the stopwords are
+// removed, the other words are lowercased and stemmed, in a single
+// call. option: `unaccent` (the words without diacritics).
+typedef struct
+{
+  int opts; // NORM_*
+} DictTerms;
+
+Datum
+jusquci_terms_init(PG_FUNCTION_ARGS)
+{
+  List* options = (List*)PG_GETARG_POINTER(0);
+  DictTerms* d = (DictTerms*)palloc0(sizeof(DictTerms));
+  ListCell* l;
+
+  d->opts = NORM_LOWER;
+  foreach (l, options) {
+    DefElem* def = (DefElem*)lfirst(l);
+
+    if (strcmp(def->defname, "unaccent") == 0) {
+      if (defGetBoolean(def))
+        d->opts |= NORM_UNACCENT;
+    } else
+      ereport(ERROR,
+        (errcode(ERRCODE_INVALID_PARAMETER_VALUE),
+         errmsg("unrecognized jusquci_terms parameter: \"%s\"",
+           def->defname)));
+  }
+
+  PG_RETURN_POINTER(d);
+}
+
+Datum
+jusquci_terms_lexize(PG_FUNCTION_ARGS)
+{
+  DictTerms* d = (DictTerms*)PG_GETARG_POINTER(0);
+  char* in = (char*)PG_GETARG_POINTER(1);
+  int len = PG_GETARG_INT32(2);
+
+  // a stopword is an empty list of lexemes
+  TSLexeme* res = (TSLexeme*)palloc0(sizeof(TSLexeme) * 2);
+  pg_wchar* word = (pg_wchar*)palloc(sizeof(pg_wchar) * (size_t)(len + 1));
+  pg_wchar* term =
+    (pg_wchar*)palloc(sizeof(pg_wchar) * (size_t)(2 * len + 1));
+  int n;
+
+  n = pg_mb2wchar_with_len(in, word, len);
+  n = norm_word(term, word, n, d->opts);
+  n = make_term(term, n);
+
+  if (n) {
+    res[0].lexeme = (char*)palloc(
+      (size_t)(pg_database_encoding_max_length() * n + 1));
+    pg_wchar2mb_with_len(term, res[0].lexeme, n);
+  }
+
+  pfree(word);
+  pfree(term);
+  PG_RETURN_POINTER(res);
+}
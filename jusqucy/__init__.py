@@ -1,4 +1,13 @@
-from jusqucy.jusqucy import tokenize, ttypify
+from jusqucy.jusqucy import tokenize, ttypify, load_lexicon, terms
+from jusqucy.jusqucy import stats, reset_stats
+from jusqucy.jusqucy import NORM_LOWER, NORM_UNACCENT
+from jusqucy.jusqucy import OPT_EMOTICONS, OPT_EMOJIS, OPT_CITEKEYS
+from jusqucy.jusqucy import OPT_INCLUSIVE, OPT_NONE, OPT_ALL
+from jusqucy.jusqucy import TYPES_ALL, LIST_WORDS, LIST_TYPES, LIST_SPACES
+from jusqucy.jusqucy import LIST_SENTS, LIST_ALL
+from jusqucy.jusqucy import HASH_MURMUR, HASH_FNV
+from jusqucy.jusqucy import SH_UPPER, SH_LOWER, SH_TITLE, SH_LIKENUM
+from jusqucy.jusqucy import SH_DIGIT, SH_ACCENT, SH_APOSTROPHE, SH_INCLUSIVE
 from jusqucy.ttypes import TokenType
 
 try:
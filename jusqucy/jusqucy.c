@@ -1,22 +1,127 @@
 #define PY_SSIZE_T_CLEAN
 #include <Python.h>
 
+#include "../src/lexicon.h"
+#include "../src/parallel.h"
 #include "../src/parser.h"
+#include "../src/probes.h"
+#include "../src/stats.h"
+#include "../src/terms.h"
 #include "../src/typifier.h"
 
+#define LEXICON_CAPSULE "jusqucy.lexicon"
+
+/* the longest text: the positions of the parser are `int`, and the
+ * arena of the normalized forms is twice as long as the text (longer
+ * texts are tokenized by windows, in C: see src/large.h) */
+#define MAX_TEXT_LEN (INT_MAX / 2)
+
+static void
+free_lexicon_capsule(PyObject* capsule)
+{
+  TLexicon* lex = PyCapsule_GetPointer(capsule, LEXICON_CAPSULE);
+
+  free_lexicon(lex);
+  PyMem_Free(lex);
+}
+
+static PyObject*
+load_lexicon_file(PyObject* self, PyObject* arg)
+{
+  PyObject* path;
+  TLexicon* lex;
+  PyObject* ret;
+
+  /* get the path (str or bytes) */
+  if (!PyUnicode_FSConverter(arg, &path))
+    return NULL;
+
+  lex = PyMem_Malloc(sizeof(TLexicon));
+  if (!lex) {
+    Py_DECREF(path);
+    return PyErr_NoMemory();
+  }
+
+  /* the file is mapped, not read: it's shared between processes. */
+  if (load_lexicon(lex, PyBytes_AS_STRING(path))) {
+    PyErr_Format(
+      PyExc_ValueError, "not a lexicon file: %s", PyBytes_AS_STRING(path));
+    PyMem_Free(lex);
+    Py_DECREF(path);
+    return NULL;
+  }
+  Py_DECREF(path);
+
+  ret = PyCapsule_New(lex, LEXICON_CAPSULE, free_lexicon_capsule);
+  if (!ret) {
+    free_lexicon(lex);
+    PyMem_Free(lex);
+  }
+
+  return ret;
+}
+
+/* the lists returned by `tokenize` (the others are None) */
+#define LIST_WORDS 0x01
+#define LIST_TYPES 0x02
+#define LIST_SPACES 0x04
+#define LIST_SENTS 0x08
+#define LIST_ALL 0x0f
+#define OR_NONE(list) ((list) ? (list) : Py_None)
+
+/* the text as code points, followed by the padding of the parser
+ * (JUSQUCI_PAD '\0', see `pst->padded`), in the copy that is made
+ * anyway. freed with PyMem_FREE. */
+static Py_UCS4*
+padded_ucs4(PyObject* input, Py_ssize_t len)
+{
+  Py_UCS4* str = PyMem_Malloc(sizeof(Py_UCS4) * (size_t)(len + JUSQUCI_PAD));
+
+  if (str && !PyUnicode_AsUCS4(input, str, len + JUSQUCI_PAD, 0)) {
+    PyMem_FREE(str);
+    return NULL;
+  }
+  if (str)
+    memset(&str[len], 0, sizeof(Py_UCS4) * JUSQUCI_PAD);
+
+  return str;
+}
+
 static PyObject*
-tokenize(PyObject* self, PyObject* arg)
+tokenize(PyObject* self, PyObject* args, PyObject* kwds)
 {
-  TParser pst;           /* parser */
+  TParser pst;           /* the parser (its settings) */
+  TTokens tok;           /* tokens (columns) */
   Py_ssize_t len, _len;  /* len of input string */
-  int i, y, ttype;       /* for iterations */
+  int i, y, k, n;        /* for iterations */
   PyObject *input, *ret; /* input value and output values */
-  PyObject *list_words, *list_types, *list_spaces,
-    *list_sents; /* lists */
+  PyObject* lexicon = Py_None; /* a lexicon (load_lexicon), or None */
+  TNorms norms = { 0 };  /* normalized forms (NORM_*), if any */
+  int opts = OPT_ALL;    /* the tokens to recognize (OPT_*) */
+  unsigned int types = TYPES_ALL; /* the types to return (TYPE_BIT) */
+  int lists = LIST_ALL;  /* the lists to build (LIST_*) */
+  int hash = -1;         /* the hash function (HASH_*), -1 for none */
+  int shape = 0;         /* the shapes of the tokens (SH_*) */
+  PyObject *list_words = NULL, *list_types = NULL, *list_spaces = NULL,
+    *list_sents = NULL, *list_norms = NULL, *list_hashes = NULL,
+    *list_lhashes = NULL, *shapes = NULL; /* lists */
+  PyObject* items[8];    /* the lists of the tuple */
+  int n_items;
+  static char* kwlist[] = { "text", "lexicon", "norm", "opts", "types",
+    "lists", "hash", "shape", NULL };
+
+  /* get the parameters values */
+  if (!PyArg_ParseTupleAndKeywords(args, kwds, "U|OiiIiip:tokenize",
+        kwlist, &input, &lexicon, &norms.opts, &opts, &types, &lists, &hash,
+        &shape))
+    return NULL;
 
-  /* get the parameter value */
-  if (!PyArg_Parse(arg, "U:tokenize", &input)) {
-    PyErr_BadArgument();
+  if (lexicon != Py_None && !PyCapsule_IsValid(lexicon, LEXICON_CAPSULE)) {
+    PyErr_SetString(PyExc_TypeError, "lexicon: not a lexicon");
+    return NULL;
+  }
+  if (hash != -1 && hash != HASH_MURMUR && hash != HASH_FNV) {
+    PyErr_SetString(PyExc_ValueError, "hash: not a hash function");
     return NULL;
   }
 
@@ -25,160 +130,336 @@ tokenize(PyObject* self, PyObject* arg)
     PyErr_BadArgument();
     return NULL;
   }
+  if (len > MAX_TEXT_LEN) {
+    PyErr_SetString(PyExc_OverflowError, "input: text too long");
+    return NULL;
+  }
 
   Py_UCS4* str;
-  str = PyUnicode_AsUCS4Copy(input);
+  str = padded_ucs4(input, len);
   if (!str)
     return PyErr_NoMemory();
 
   /* the position in the result */
   i = 0;
   y = 0;
-  ttype = TS_START;
-
-  /* initialize the parser with the string to parse */
-  init_parser(&pst, str, (int)len);
 
-  /* allocate memory for temporary array of integers */
-  int* spaces = (int*)malloc(sizeof(int*) * (size_t)len);
-  int* idx = (int*)malloc(sizeof(int*) * (size_t)len);
-  int* lens = (int*)malloc(sizeof(int*) * (size_t)len);
-  int* _types = (int*)malloc(sizeof(int*) * (size_t)len + 1);
+  /* allocate memory for the tokens (there are never more tokens than
+   * characters) and for temporary array of integers */
+  tok.start = (uint32_t*)malloc(sizeof(uint32_t) * (size_t)len);
+  tok.len = (uint32_t*)malloc(sizeof(uint32_t) * (size_t)len);
+  tok.type = (uint8_t*)malloc(sizeof(uint8_t) * (size_t)len);
+  tok.flags = (uint8_t*)malloc(sizeof(uint8_t) * (size_t)len);
+  tok.hash = NULL;
+  tok.lhash = NULL;
+  if (hash >= 0) {
+    tok.hash = (uint64_t*)malloc(sizeof(uint64_t) * (size_t)len);
+    tok.lhash = (uint64_t*)malloc(sizeof(uint64_t) * (size_t)len);
+  }
+  tok.shape = shape ? (uint8_t*)malloc(sizeof(uint8_t) * (size_t)len) : NULL;
+  int* spaces = (int*)malloc(sizeof(int) * (size_t)len);
+
+  /* the normalized forms are written by the parser, in an arena that
+   * is twice as long as the text (it's always enough). */
+  if (norms.opts) {
+    norms.size = 2 * (int)len;
+    norms.buf = malloc(sizeof(Py_UCS4) * (size_t)norms.size);
+    norms.start = (uint32_t*)malloc(sizeof(uint32_t) * (size_t)len);
+    norms.len = (uint32_t*)malloc(sizeof(uint32_t) * (size_t)len);
+  }
 
   /* ensure that memory has been allocated */
-  if (!spaces || !idx || !lens || !_types) {
+  if (!tok.start || !tok.len || !tok.type || !tok.flags || !spaces ||
+      (norms.opts && (!norms.buf || !norms.start || !norms.len)) ||
+      (hash >= 0 && (!tok.hash || !tok.lhash)) || (shape && !tok.shape)) {
     PyMem_FREE(str);
+    free(tok.start);
+    free(tok.len);
+    free(tok.type);
+    free(tok.flags);
+    free(tok.hash);
+    free(tok.lhash);
+    free(tok.shape);
+    free(spaces);
+    free(norms.buf);
+    free(norms.start);
+    free(norms.len);
     return PyErr_NoMemory();
   }
 
-  /* get the type of the first token */
-  ttype = get_token(&pst);
-
-  /* if the list is empty, returns empty list, skip following parts.
+  /* get all the tokens at once (long texts are split between several
+   * threads, see parallel.h). */
+  init_parser(&pst, str, (int)len);
+  pst.padded = 1;
+  pst.opts = opts & OPT_ALL;
+  if (hash >= 0)
+    pst.hash = hash;
+
+  /* the other types are skipped by the parser (the spaces make the
+   * list `spaces`) */
+  pst.types = types | TYPE_BIT(TS_SPACE);
+  if (lexicon != Py_None)
+    pst.lexicon = PyCapsule_GetPointer(lexicon, LEXICON_CAPSULE);
+
+  PROBE_DOC_START(len);
+  Py_BEGIN_ALLOW_THREADS
+  n = get_tokens_parallel_norm(
+    &pst, &tok, norms.opts ? &norms : NULL, (int)len, 0);
+  Py_END_ALLOW_THREADS
+  PROBE_DOC_END(len, n);
+
+  /* iterates over the tokens. standard spaces are not added to the
+   * list (unless it's the first token), but rather modified the other
+   * list `spaces`, which indicate if a token is FOLLOWED by a space.
+   * the tokens are moved in place. the sentences starts are marked by
+   * the parser (TF_SENTSTART): a first space starts the sentence.
    */
-  if (ttype == TS_END)
-    goto MakeLists;
-
-  /* if the first token is a space, change its type */
-  else if (ttype == TS_SPACE)
-    ttype = TS_SPACESIGN;
+  for (k = 0; k < n; k++) {
+    if (tok.type[k] == TS_SPACE &&
+        (i > 0 || !(types & TYPE_BIT(TS_SPACESIGN))))
+      continue;
+    tok.start[i] = tok.start[k];
+    tok.len[i] = tok.len[k];
+    if (norms.opts) {
+      norms.start[i] = norms.start[k];
+      norms.len[i] = norms.len[k];
+    }
+    if (hash >= 0) {
+      tok.hash[i] = tok.hash[k];
+      tok.lhash[i] = tok.lhash[k];
+    }
+    if (shape)
+      tok.shape[i] = tok.shape[k];
 
-  /* add the first element. it's important to split the first item
-   * assignment and the followings, because spaces is populated by
-   * `spaces[i-1]`: i do not want to access what's outside the array
-   * (before 0)
-   */
-  spaces[0] = 0;
-  idx[0] = pst.tidx;
-  lens[0] = pst.tlen;
-
-  /* types is used for two things: `ttypes` and `is_sent_start`. */
-  _types[0] = TS_NEWLINE;
-  int* types = &_types[1];
-  types[0] = ttype;
-
-  /* start at one */
-  i = 1;
-
-  /* iterates over the tokens, until it reach the end of the
-   * tokenized text. standard spaces are not added to the list, but
-   * rather modified the other list `spaces`, which indicate if a
-   * token is FOLLOWED by a space (hence `spaces[i-1]`).
-   */
-  while ((ttype = get_token(&pst)) != TS_END) {
-    if (ttype == TS_SPACE) {
-      spaces[i - 1] = 1;
+    /* if the first token is a space, change its type */
+    if (tok.type[k] == TS_SPACE) {
+      tok.type[i] = TS_SPACESIGN;
+      tok.flags[i] = TF_SENTSTART;
     } else {
-      spaces[i] = 0;
-      idx[i] = pst.tidx;
-      lens[i] = pst.tlen;
-      types[i] = ttype;
-      i++;
+      tok.type[i] = tok.type[k];
+      tok.flags[i] = tok.flags[k];
+      if (i == 1 && tok.type[0] == TS_SPACESIGN)
+        tok.flags[i] &= (uint8_t)~TF_SENTSTART;
     }
+    spaces[i] = (k + 1 < n && tok.type[k + 1] == TS_SPACE &&
+                 tok.start[k + 1] == tok.start[i] + tok.len[i]);
+    i++;
   }
 
-MakeLists:
-
-  /* make the python objects: three lists.*/
-  list_words = PyList_New(i);
-  list_types = PyList_New(i);
-  list_spaces = PyList_New(i);
-  list_sents = PyList_New(i);
-
-  int* sents = (int*)malloc(sizeof(int*) * (size_t)i + 1);
-  sents[i + 1] = 0;
-
-  if (!list_words || !list_types || !list_words || !list_sents) {
+  /* make the python objects: four lists (five with the norms, two more
+   * with the hashes, and the shapes: bytes, one per token), or None for
+   * the lists that are not wanted.*/
+  if (lists & LIST_WORDS)
+    list_words = PyList_New(i);
+  if (lists & LIST_TYPES)
+    list_types = PyList_New(i);
+  if (lists & LIST_SPACES)
+    list_spaces = PyList_New(i);
+  if (lists & LIST_SENTS)
+    list_sents = PyList_New(i);
+  if (norms.opts)
+    list_norms = PyList_New(i);
+  if (hash >= 0) {
+    list_hashes = PyList_New(i);
+    list_lhashes = PyList_New(i);
+  }
+  if (shape)
+    shapes = PyBytes_FromStringAndSize((const char*)tok.shape, i);
+
+  if (((lists & LIST_WORDS) && !list_words) ||
+      ((lists & LIST_TYPES) && !list_types) ||
+      ((lists & LIST_SPACES) && !list_spaces) ||
+      ((lists & LIST_SENTS) && !list_sents) ||
+      (norms.opts && !list_norms) ||
+      (hash >= 0 && (!list_hashes || !list_lhashes)) || (shape && !shapes)) {
     ret = PyErr_NoMemory();
     Py_XDECREF(list_types);
     Py_XDECREF(list_words);
     Py_XDECREF(list_spaces);
     Py_XDECREF(list_sents);
+    Py_XDECREF(list_norms);
+    Py_XDECREF(list_hashes);
+    Py_XDECREF(list_lhashes);
+    Py_XDECREF(shapes);
     goto FreeEnd;
   }
 
   /* populate the lists */
-  int isword = 0;
   for (y = 0; y < i; y++) {
-    PyObject* word = PyUnicode_FromKindAndData(
-      PyUnicode_4BYTE_KIND, &str[idx[y]], lens[y]);
-    PyObject* space = PyLong_FromLong(spaces[y]);
-    PyObject* ttype = PyLong_FromLong(types[y]);
-
-    PyList_SET_ITEM(list_words, y, word);
-    PyList_SET_ITEM(list_spaces, y, space);
-    PyList_SET_ITEM(list_types, y, ttype);
-
-    Py_DECREF(space);
-    Py_DECREF(ttype);
-
-    switch (types[y - 1]) {
-      case TS_EMOTICON:
-      case TS_EMOJI:
-      case TS_URL:
-      case TS_NEWLINE:
-      case TS_PUNCTSTRONG:
-        sents[y] = 1;
-        break;
-      default:
-        sents[y] = 0;
-        break;
+    if (list_words)
+      PyList_SET_ITEM(list_words, y,
+        PyUnicode_FromKindAndData(
+          PyUnicode_4BYTE_KIND, &str[tok.start[y]], tok.len[y]));
+    if (list_spaces)
+      PyList_SET_ITEM(list_spaces, y, PyLong_FromLong(spaces[y]));
+    if (list_types)
+      PyList_SET_ITEM(list_types, y, PyLong_FromLong(tok.type[y]));
+    if (list_sents)
+      PyList_SET_ITEM(list_sents, y,
+        PyLong_FromLong((tok.flags[y] & TF_SENTSTART) ? 1 : -1));
+
+    if (norms.opts) {
+      PyObject* norm = PyUnicode_FromKindAndData(PyUnicode_4BYTE_KIND,
+        (Py_UCS4*)norms.buf + norms.start[y], norms.len[y]);
+      PyList_SET_ITEM(list_norms, y, norm);
+    }
+    if (hash >= 0) {
+      PyList_SET_ITEM(
+        list_hashes, y, PyLong_FromUnsignedLongLong(tok.hash[y]));
+      PyList_SET_ITEM(
+        list_lhashes, y, PyLong_FromUnsignedLongLong(tok.lhash[y]));
     }
   }
 
-  PyObject* is_sent_start = PyLong_FromLong(1);
-  PyObject* isnt_sent_start = PyLong_FromLong(-1);
-
-  for (y = 0; y < i; y++) {
-    if (sents[y] && !sents[y + 1])
-      PyList_SET_ITEM(list_sents, y, is_sent_start);
-    else
-      PyList_SET_ITEM(list_sents, y, isnt_sent_start);
+  /* build the final tuple (the norms, the hashes, then the shapes, at
+   * the end) */
+  items[0] = OR_NONE(list_words);
+  items[1] = OR_NONE(list_types);
+  items[2] = OR_NONE(list_spaces);
+  items[3] = OR_NONE(list_sents);
+  n_items = 4;
+  if (norms.opts)
+    items[n_items++] = list_norms;
+  if (hash >= 0) {
+    items[n_items++] = list_hashes;
+    items[n_items++] = list_lhashes;
+  }
+  if (shape)
+    items[n_items++] = shapes;
+  if ((ret = PyTuple_New(n_items))) {
+    for (k = 0; k < n_items; k++) {
+      Py_INCREF(items[k]);
+      PyTuple_SET_ITEM(ret, k, items[k]);
+    }
   }
-
-  Py_DECREF(is_sent_start);
-  Py_DECREF(isnt_sent_start);
-
-  /* build the final tuple */
-  ret = PyTuple_Pack(
-    4, list_words, list_types, list_spaces, list_sents);
 
   /* decrement reference count of each list. */
-  Py_DECREF(list_types);
-  Py_DECREF(list_words);
-  Py_DECREF(list_spaces);
-  Py_DECREF(list_sents);
+  Py_XDECREF(list_types);
+  Py_XDECREF(list_words);
+  Py_XDECREF(list_spaces);
+  Py_XDECREF(list_sents);
+  Py_XDECREF(list_norms);
+  Py_XDECREF(list_hashes);
+  Py_XDECREF(list_lhashes);
+  Py_XDECREF(shapes);
 
 FreeEnd:
 
   PyMem_FREE(str);
 
   /* free memory for the parser and for the jchar* string */
+  free(tok.start);
+  free(tok.len);
+  free(tok.type);
+  free(tok.flags);
+  free(tok.hash);
+  free(tok.lhash);
+  free(tok.shape);
   free(spaces);
-  free(idx);
-  free(lens);
-  free(_types);
-  free(sents);
+  free(norms.buf);
+  free(norms.start);
+  free(norms.len);
+
+  return ret;
+}
+
+static PyObject*
+get_terms_list(PyObject* self, PyObject* args)
+{
+  TParser pst;           /* the parser (its settings) */
+  TTokens tok;           /* tokens (columns) */
+  TNorms norms = { 0 };  /* the terms */
+  Py_ssize_t len;        /* len of input string */
+  int n;                 /* number of terms */
+  PyObject *input, *ret = NULL;
+  PyObject* lexicon = Py_None;
+  PyObject *list_terms = NULL, *list_starts = NULL;
+  Py_UCS4* str;
+
+  /* get the parameters values (NORM_LOWER is always set) */
+  if (!PyArg_ParseTuple(
+        args, "U|Oi:terms", &input, &lexicon, &norms.opts))
+    return NULL;
+  norms.opts |= NORM_LOWER;
+
+  if (lexicon != Py_None && !PyCapsule_IsValid(lexicon, LEXICON_CAPSULE)) {
+    PyErr_SetString(PyExc_TypeError, "lexicon: not a lexicon");
+    return NULL;
+  }
+
+  if ((len = PyUnicode_GetLength(input)) == -1) {
+    PyErr_BadArgument();
+    return NULL;
+  }
+  if (len > MAX_TEXT_LEN) {
+    PyErr_SetString(PyExc_OverflowError, "input: text too long");
+    return NULL;
+  }
+
+  str = padded_ucs4(input, len);
+  if (!str)
+    return PyErr_NoMemory();
+
+  /* the tokens and their normalized forms (see `tokenize`) */
+  tok.start = (uint32_t*)malloc(sizeof(uint32_t) * (size_t)len);
+  tok.len = (uint32_t*)malloc(sizeof(uint32_t) * (size_t)len);
+  tok.type = (uint8_t*)malloc(sizeof(uint8_t) * (size_t)len);
+  tok.flags = (uint8_t*)malloc(sizeof(uint8_t) * (size_t)len);
+  tok.hash = NULL;
+  tok.lhash = NULL;
+  tok.shape = NULL;
+  norms.size = 2 * (int)len;
+  norms.buf = malloc(sizeof(Py_UCS4) * (size_t)norms.size);
+  norms.start = (uint32_t*)malloc(sizeof(uint32_t) * (size_t)len);
+  norms.len = (uint32_t*)malloc(sizeof(uint32_t) * (size_t)len);
+
+  if (!tok.start || !tok.len || !tok.type || !tok.flags || !norms.buf ||
+      !norms.start || !norms.len) {
+    ret = PyErr_NoMemory();
+    goto FreeEnd;
+  }
+
+  init_parser(&pst, str, (int)len);
+  pst.padded = 1;
+  pst.types = TERM_TYPES;
+  if (lexicon != Py_None)
+    pst.lexicon = PyCapsule_GetPointer(lexicon, LEXICON_CAPSULE);
+
+  /* the terms are made from the normalized forms, in place. */
+  Py_BEGIN_ALLOW_THREADS
+  n = get_tokens_parallel_norm(&pst, &tok, &norms, (int)len, 0);
+  n = make_terms(&tok, &norms, n);
+  Py_END_ALLOW_THREADS
+
+  /* two lists: the terms, and the positions of their tokens */
+  list_terms = PyList_New(n);
+  list_starts = PyList_New(n);
+  if (!list_terms || !list_starts) {
+    ret = PyErr_NoMemory();
+    goto FreeEnd;
+  }
+
+  for (int y = 0; y < n; y++) {
+    PyList_SET_ITEM(list_terms, y,
+      PyUnicode_FromKindAndData(PyUnicode_4BYTE_KIND,
+        (Py_UCS4*)norms.buf + norms.start[y], norms.len[y]));
+    PyList_SET_ITEM(list_starts, y, PyLong_FromLong(tok.start[y]));
+  }
+
+  ret = PyTuple_Pack(2, list_terms, list_starts);
+
+FreeEnd:
+
+  Py_XDECREF(list_terms);
+  Py_XDECREF(list_starts);
+  PyMem_FREE(str);
+  free(tok.start);
+  free(tok.len);
+  free(tok.type);
+  free(tok.flags);
+  free(norms.buf);
+  free(norms.start);
+  free(norms.len);
 
   return ret;
 }
@@ -281,12 +562,48 @@ ttypify_token(PyObject* self, PyObject* arg)
 
 }
 
+/* the hot-path counters, as a dict (empty if the module was not
+ * built with them: `make stats`). */
+static PyObject*
+get_stats(PyObject* self, PyObject* args)
+{
+  PyObject* dict = PyDict_New();
+
+  if (!dict || !stats_enabled())
+    return dict;
+
+  for (int i = 0; i < N_STATS; i++) {
+    PyObject* count = PyLong_FromUnsignedLongLong(jusquci_stats[i]);
+    if (!count || PyDict_SetItemString(dict, jusquci_stats_names[i], count)) {
+      Py_XDECREF(count);
+      Py_DECREF(dict);
+      return NULL;
+    }
+    Py_DECREF(count);
+  }
+
+  return dict;
+}
+
+static PyObject*
+reset_stats_counters(PyObject* self, PyObject* args)
+{
+  reset_stats();
+  Py_RETURN_NONE;
+}
+
 /* informations about the module, so it can be called from within
  * python. */
 static PyMethodDef jusqucy_methods[] = {
-  { "tokenize", tokenize, METH_O, "Tokenize a text." },
+  { "tokenize", (PyCFunction)(void (*)(void))tokenize,
+    METH_VARARGS | METH_KEYWORDS, "Tokenize a text." },
+  { "terms", get_terms_list, METH_VARARGS, "Get the index terms of a text." },
+  { "load_lexicon", load_lexicon_file, METH_O, "Load a lexicon file." },
   { "get_ttype_norm", get_ttype_norm, METH_O, "Normalize a special token." },
   { "ttypify", ttypify_token, METH_O, "Typify a token." },
+  { "stats", get_stats, METH_NOARGS, "Get the hot-path counters." },
+  { "reset_stats", reset_stats_counters, METH_NOARGS,
+    "Reset the hot-path counters." },
   { NULL, NULL, 0, NULL }
 };
 
@@ -305,5 +622,37 @@ static struct PyModuleDef jusqucy_module = {
 PyMODINIT_FUNC
 PyInit_jusqucy(void)
 {
-  return PyModule_Create(&jusqucy_module);
+  PyObject* module = PyModule_Create(&jusqucy_module);
+
+  /* the normalized forms: `tokenize(text, None, NORM_LOWER)` */
+  if (module &&
+      (PyModule_AddIntConstant(module, "NORM_LOWER", NORM_LOWER) ||
+       PyModule_AddIntConstant(module, "NORM_UNACCENT", NORM_UNACCENT) ||
+       PyModule_AddIntConstant(module, "OPT_EMOTICONS", OPT_EMOTICONS) ||
+       PyModule_AddIntConstant(module, "OPT_EMOJIS", OPT_EMOJIS) ||
+       PyModule_AddIntConstant(module, "OPT_CITEKEYS", OPT_CITEKEYS) ||
+       PyModule_AddIntConstant(module, "OPT_INCLUSIVE", OPT_INCLUSIVE) ||
+       PyModule_AddIntConstant(module, "OPT_NONE", OPT_NONE) ||
+       PyModule_AddIntConstant(module, "OPT_ALL", OPT_ALL) ||
+       PyModule_AddIntConstant(module, "TYPES_ALL", TYPES_ALL) ||
+       PyModule_AddIntConstant(module, "HASH_MURMUR", HASH_MURMUR) ||
+       PyModule_AddIntConstant(module, "HASH_FNV", HASH_FNV) ||
+       PyModule_AddIntConstant(module, "SH_UPPER", SH_UPPER) ||
+       PyModule_AddIntConstant(module, "SH_LOWER", SH_LOWER) ||
+       PyModule_AddIntConstant(module, "SH_TITLE", SH_TITLE) ||
+       PyModule_AddIntConstant(module, "SH_LIKENUM", SH_LIKENUM) ||
+       PyModule_AddIntConstant(module, "SH_DIGIT", SH_DIGIT) ||
+       PyModule_AddIntConstant(module, "SH_ACCENT", SH_ACCENT) ||
+       PyModule_AddIntConstant(module, "SH_APOSTROPHE", SH_APOSTROPHE) ||
+       PyModule_AddIntConstant(module, "SH_INCLUSIVE", SH_INCLUSIVE) ||
+       PyModule_AddIntConstant(module, "LIST_WORDS", LIST_WORDS) ||
+       PyModule_AddIntConstant(module, "LIST_TYPES", LIST_TYPES) ||
+       PyModule_AddIntConstant(module, "LIST_SPACES", LIST_SPACES) ||
+       PyModule_AddIntConstant(module, "LIST_SENTS", LIST_SENTS) ||
+       PyModule_AddIntConstant(module, "LIST_ALL", LIST_ALL))) {
+    Py_DECREF(module);
+    return NULL;
+  }
+
+  return module;
 }
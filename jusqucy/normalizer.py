@@ -12,9 +12,14 @@ def normalize(doc):
     Returns (Doc)
     """
 
-    for token, norm in zip(
-        doc, map(get_ttype_norm, doc._.jusqucy_ttypes)
+    # the normalized forms written by the tokenizer (`norm`), if any.
+    norms = doc._.jusqucy_norms or [0] * len(doc)
+
+    for token, norm, fused in zip(
+        doc, map(get_ttype_norm, doc._.jusqucy_ttypes), norms
     ):
         if norm != 0:
             token.norm_ = norm
+        elif fused:
+            token.norm_ = fused
     return doc
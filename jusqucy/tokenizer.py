@@ -3,7 +3,7 @@
 from spacy.tokens import Doc, Token
 from spacy.vocab import Vocab
 from spacy import registry
-from .jusqucy import tokenize
+from .jusqucy import tokenize, load_lexicon, OPT_ALL
 from .ttypes import get_ttype, token_isword
 from typing import Union
 
@@ -14,10 +14,33 @@ class JusqucyTokenizer:
         vocab: Vocab,
         ext_token_ttype: Union[str, None] = "isword",
         ext_token_isword: Union[str, None] = "ttype",
+        lexicon: Union[str, None] = None,
+        norm: int = 0,
+        opts: int = OPT_ALL,
+        shape: bool = False,
     ):
         self.vocab = vocab
 
+        # the tokens to recognize (OPT_EMOTICONS, OPT_EMOJIS,
+        # OPT_CITEKEYS, OPT_INCLUSIVE): the fewer, the faster.
+        self.opts = opts
+
+        # the normalized forms (NORM_LOWER, NORM_UNACCENT), written by
+        # the parser during the tokenization: Doc._.jusqucy_norms.
+        self.norm = norm
+
+        # the shapes of the tokens (SH_UPPER, SH_TITLE, SH_LIKENUM...),
+        # read by the parser: Doc._.jusqucy_shapes (bytes, one per
+        # token).
+        self.shape = shape
+
+        # a lexicon file (tools/mklexicon -o), instead of the built-in
+        # lists of abbreviations, inversions and suffixes.
+        self.lexicon = load_lexicon(lexicon) if lexicon else None
+
         Doc.set_extension("jusqucy_ttypes", default=None, force=True)
+        Doc.set_extension("jusqucy_norms", default=None, force=True)
+        Doc.set_extension("jusqucy_shapes", default=None, force=True)
 
         if ext_token_ttype:
             Token.set_extension(
@@ -38,7 +61,9 @@ class JusqucyTokenizer:
         Returns (Doc): the spacy.tokens.Doc.
         """
 
-        words, ttypes, spaces, sent_starts = tokenize(text)
+        words, ttypes, spaces, sent_starts, *extra = tokenize(
+            text, self.lexicon, self.norm, self.opts, shape=self.shape
+        )
 
         doc = Doc(
             words=words,
@@ -48,6 +73,10 @@ class JusqucyTokenizer:
             **kwargs,
         )
         doc._.jusqucy_ttypes = ttypes
+        if self.norm:
+            doc._.jusqucy_norms = extra[0]
+        if self.shape:
+            doc._.jusqucy_shapes = extra[-1]
 
         return doc
 
@@ -66,10 +95,20 @@ class JusqucyTokenizer:
 def create_tokenizer(
     ext_token_ttype: Union[str, None] = "ttype",
     ext_token_isword: Union[str, None] = "isword",
+    lexicon: Union[str, None] = None,
+    norm: int = 0,
+    opts: int = OPT_ALL,
+    shape: bool = False,
 ):
     def make_tokenizer(nlp):
         return JusqucyTokenizer(
-            nlp.vocab, ext_token_ttype, ext_token_isword
+            nlp.vocab,
+            ext_token_ttype,
+            ext_token_isword,
+            lexicon,
+            norm,
+            opts,
+            shape,
         )
 
     return make_tokenizer
@@ -1,249 +1,161 @@
 #include "affixes.h"
+#include "lexicon.h"
 #include "util.h"
-#include <wchar.h>
-#include <wctype.h>
+
+/* the feminine suffixes, the inversions, the abbreviations and the
+ * ordinal suffixes are in the lexicon (see lexicon.h). */
 
 /* "-rice-s", "-rice-x", "-rice-x-s" */
-const recaffix suff_plural_s = {
+static const recaffix suff_plural_s = {
   U"s",
   1,
   0,
   NULL,
 };
-const recaffix* const suff_plural[] = {
+static const recaffix* const suff_plural[] = {
   &suff_plural_s,
 };
-const recaffix suff_nonbinary_s = {
+static const recaffix suff_nonbinary_s = {
   U"x",
   1,
   1,
   suff_plural,
 };
-const recaffix* const suff_nonbinary[] = {
-  &suff_nonbinary_s,
-};
-const recaffix* const suff_plural_nonbinary[] = {
+
+/* optional parts of the feminine suffixes */
+#define N_SUFF_OPTS 2
+static const recaffix* const suff_plural_nonbinary[] = {
   &suff_plural_s,
   &suff_nonbinary_s,
 };
 
-/* feminine suffixes */
-const recaffix suff_feminine[] = {
-#define N_SUFF_FEMININE 15
-#define xs 2, suff_plural_nonbinary
-  { U"e", 1, xs },
-  { U"te", 2, xs },
-  { U"euse", 4, xs },
-  { U"ese", 3, xs },
-  { U"ère", 3, xs },
-  { U"ice", 3, xs },
-  { U"rice", 4, xs },
-  { U"trice", 5, xs },
-  { U"ale", 3, xs },
-  { U"ne", 2, xs },
-  { U"ive", 3, xs },
-  { U"esse", 4, xs },
-  { U"oresse", 6, xs },
-  { U"se", 2, xs },
-  { U"fe", 2, xs },
-#undef xs
-};
+/* the character at index `i`, and the index after it (`next`). in a
+ * decomposed text (nfd), a letter and its combining mark are read as
+ * a single letter, as in the lexicon: "e" + U+0301 is "é". */
+static inline jchar
+JFN(read_composed)(TParser* pst, int i, int* next)
+{
+  jchar c = JCH(pst, i);
+  jchar mark, composed;
 
-/* "peut-on", "arrivons-nous", "prends-les" */
-const recaffix inversion[] = {
-#define N_WORD_INVERSION 28
-#define no 0, NULL
-  { U"je", 2, no },
-  { U"là", 2, no },
-  { U"ci", 2, no },
-  { U"t", 1, no },
-  { U"m", 1, no },
-  { U"tu", 2, no },
-  { U"on", 2, no },
-  { U"nous", 4, no },
-  { U"vous", 4, no },
-  { U"elle", 4, no },
-  { U"il", 2, no },
-  { U"ils", 3, no },
-  { U"elles", 5, no },
-  { U"iel", 3, no },
-  { U"iels", 4, no },
-  { U"moi", 3, no },
-  { U"toi", 3, no },
-  { U"lui", 3, no },
-  { U"leur", 4, no },
-  { U"eux", 3, no },
-  { U"elleux", 6, no },
-  { U"en", 2, no },
-  { U"ce", 2, no },
-  { U"y", 1, no },
-  { U"la", 2, no },
-  { U"les", 3, no },
-  { U"le", 2, no },
-  { U"ici", 3, no },
-#undef no
-};
+  *next = JNEXT(pst, i);
+  if (c >= 0x80 || *next >= pst->strlen)
+    return c;
 
-/* very minimalistic support for abbreviations. these ones are very
- * common ones (ex., tél., env.) or ones relative to literature
- * (because i know those). i don't include, e.g. "art.", "vol.":
- * because those are words!
- */
-const affix abbrev[] = {
-#define N_ABBREV 20
-#define LEN_ABBREV_MAX 4
-  { NULL, 0 },
-  { U"ch", 2 },
-  { U"ph", 2 },
-  { U"al", 2 },
-  { U"auj", 3 },
-  { U"chap", 4 },
-  { U"cit", 3 },
-  { U"dir", 3 },
-  { U"éd", 2 },
-  { U"ed", 2 },
-  { U"env", 3 },
-  { U"ex", 2 },
-  { U"fig", 3 },
-  { U"hab", 3 },
-  { U"maj", 3 },
-  { U"pp", 2 },
-  { U"tel", 3 },
-  { U"tél", 3 },
-  { U"dr", 2 },
-  { U"mme", 2 },
-  { U"mr", 2 },
-  { NULL, 0 },
-};
+  mark = JCH(pst, *next);
+  if (mark < 0x300 || !(jch_ctype(mark) & JCH_MARK) ||
+      !(composed = jch_compose(c, mark)))
+    return c;
+
+  *next = JNEXT(pst, *next);
+  return composed;
+}
 
 /* compare a string with a suffix */
-jchar*
-match_recaff(jchar* str, const recaffix* affix, int max, jchar sep)
+int
+JFN(match_recaff)(TParser* pst, int i, const recaffix* affix, jchar sep)
 {
-
-  int i;
-  jchar* endptr;
-  jchar c;
-  jchar* x;
-
-  /* if there is not enough space for the suffix, it does not match
+  /* ensure all the characters from the suffixes are in the string.
+   * if there is not enough space for the suffix, it does not match.
    */
-  if (max < affix->len)
-    return NULL;
+  for (int k = 0; k < affix->len; k++) {
+    if (i >= pst->strlen || jtowlower(JCH(pst, i)) != affix->str[k])
+      return 0;
+    i = JNEXT(pst, i);
+  }
 
-  i = affix->len;
+  return JFN(match_opts)(pst, i, affix->opts, affix->n_opts, sep);
+}
 
-  /* ensure all the characters from the suffixes are in the string
-   */
-  for (i = 0; i < affix->len; i++) {
-    if (towlower(str[i]) != affix->str[i])
-      return NULL;
-  }
+/* what follows an affix */
+int
+JFN(match_opts)(TParser* pst,
+  int i,
+  const recaffix* const* opts,
+  int n_opts,
+  jchar sep)
+{
 
-  /* pointer to the end of the string */
-  endptr = &str[i];
+  int endidx;
+  jchar c;
+  int x;
+
+  /* index of the end of the affix */
+  endidx = i;
 
   /* if the string reached the end, it matches */
-  if ((max - i) == 0)
-    return endptr;
+  if (i == pst->strlen)
+    return endidx;
 
   /* else, get the character class of the next characters. */
-  c = str[i];
+  c = JCH(pst, i);
 
   /* if the next character is not a a word character, then it's a
    * match. and if it's not the separator, the match don't go
    * forward, so the function can end. */
   if (!iswordch(c) && c != sep)
-    return endptr;
+    return endidx;
 
   /* if the next char is the suffix separator, then the match could
    * continue. if it doesn't, it still a match.
    */
   else if (c == sep)
-    i++;
+    i = JNEXT(pst, i);
 
   /* if it's a word character, the match could continue, too. but if
    * it does not, it's not a match at all.
    */
   else
-    endptr = NULL;
+    endidx = 0;
 
   /* try to match every optional suffix. */
-  for (int iopt = 0; iopt < affix->n_opts; iopt++) {
+  for (int iopt = 0; iopt < n_opts; iopt++) {
 
     /* recursive call, like in "auteur-rice-x-s". */
-    x = match_recaff(&str[i], affix->opts[iopt], (max - i), sep);
+    x = JFN(match_recaff)(pst, i, opts[iopt], sep);
     if (x)
       return x;
   }
 
-  return endptr;
+  return endidx;
 }
 
-jchar*
-match_aff(jchar* str, const recaffix* affix, int max)
+/* match a whole word of the lexicon, from `i` to the next character
+ * that is not a word character. returns the index of the end of the
+ * word, or 0. */
+static int
+JFN(match_word)(TParser* pst, int i, int list)
 {
-
-  int i;
-  jchar* endptr;
+  const TLexicon* lex = pst->lexicon;
+  uint32_t node = 0;
   jchar c;
-
-  /* if there is not enough space for the suffix, it does not match
-   */
-  if (max < affix->len)
-    return NULL;
-
-  i = affix->len;
-
-  /* ensure all the characters from the suffixes are in the string
-   */
-  for (i = 0; i < affix->len; i++) {
-    if (towlower(str[i]) != affix->str[i])
-      return NULL;
+  int next;
+
+  for (; i < pst->strlen; i = next) {
+    c = JFN(read_composed)(pst, i, &next);
+    if (!iswordch(c))
+      break;
+    node = lex_child(lex, node, jtowlower(c));
+    if (!node || !(lex->nodes[node].prefix & list))
+      return 0;
   }
 
-  /* pointer to the end of the string */
-  endptr = &str[i];
-
-  /* if the string reached the end, it matches */
-  if ((max - i) == 0)
-    return endptr;
-
-  /* else, get the character class of the next characters. */
-  c = str[i];
-
-  /* if the next character is not a a word character, then it's a
-   * match. and if it's not the separator, the match don't go
-   * forward, so the function can end. */
-  if (!iswordch(c))
-    return endptr;
-
-  /* if it's a word character, the match could continue, too. but if
-   * it does not, it's not a match at all.
-   */
-  else
-    return NULL;
+  return (lex->nodes[node].term & list) ? i : 0;
 }
 
 /* penses-tu */
 int
-is_inversion(TParser* pst)
+JFN(is_inversion)(TParser* pst)
 {
-  jchar* p = &pst->str[pst->pos];
-  jchar* x = NULL;
-  int remain = (pst->strlen - pst->pos) - 1;
-
-  for (int i = 0; i < N_WORD_INVERSION; i++) {
-
-    x = match_aff(p + 1, &inversion[i], remain);
-
-    if (x) {
-      /* exclude "Vaison-la-Romaine". */
-      if (remain+1 > x-p && x[0] == L'-')
-        return 0;
-      else
-        return 1;
-    }
+  /* skip the '-' */
+  int x = JFN(match_word)(pst, pst->pos + 1, LEX_INVERSION);
+
+  if (x) {
+    /* exclude "Vaison-la-Romaine". */
+    if (x < pst->strlen && JCH(pst, x) == L'-')
+      return 0;
+    else
+      return 1;
   }
 
   return 0;
@@ -251,13 +163,15 @@ is_inversion(TParser* pst)
 
 /* p. ex. */
 int
-is_abbrev(TParser* pst)
+JFN(is_abbrev)(TParser* pst)
 {
-  size_t len = (size_t)(pst->pos - pst->tidx);
-  jchar c = pst->str[pst->pos - 1];
-  jchar* p = &pst->str[pst->tidx];
+  const TLexicon* lex = pst->lexicon;
+  uint32_t node = 0;
+  int next;
+  jchar c = JFN(read_composed)(pst, pst->tidx, &next);
 
-  if (len == 1) {
+  /* a single letter */
+  if (next == pst->pos) {
     switch (c) {
       case L'a':
       case L'à':
@@ -269,34 +183,61 @@ is_abbrev(TParser* pst)
     }
   }
 
-  if (len > LEN_ABBREV_MAX) {
-    return 0;
-  }
-
-  for (int i = 1; i < N_ABBREV; i++) {
-    if (abbrev[i].len == len && cmpi(p, abbrev[i].str, len)) {
-      return 1;
-    }
+  /* the whole token must be in the lexicon */
+  for (int i = pst->tidx; i < pst->pos; i = next) {
+    node = lex_child(lex, node, jtowlower(JFN(read_composed)(pst, i, &next)));
+    if (!node || !(lex->nodes[node].prefix & LEX_ABBREV))
+      return 0;
   }
 
-  return 0;
+  return (lex->nodes[node].term & LEX_ABBREV) ? 1 : 0;
 }
 
 /* enseignant.e */
 int
-is_incl_suff(TParser* pst, jchar sep)
+JFN(is_incl_suff)(TParser* pst, jchar sep)
 {
-  jchar* cur = &pst->str[pst->pos];
-  jchar* x = NULL;
-  int remain = (pst->strlen - pst->pos) - 1;
-
-  for (int i = 0; i < N_SUFF_FEMININE; i++) {
+  const TLexicon* lex = pst->lexicon;
+  uint32_t node = 0;
+  int best = 0;
+  int next;
+  int x;
+
+  /* skip the separator, and go along the suffixes: each time one
+   * ends, try its optional parts, and keep the longest match. */
+  for (int i = JNEXT(pst, pst->pos); i < pst->strlen;) {
+    node = lex_child(lex, node, jtowlower(JFN(read_composed)(pst, i, &next)));
+    if (!node || !(lex->nodes[node].prefix & LEX_SUFFIX))
+      break;
+    i = next;
+    if ((lex->nodes[node].term & LEX_SUFFIX) &&
+        (x = JFN(match_opts)(
+           pst, i, suff_plural_nonbinary, N_SUFF_OPTS, sep)))
+      best = x;
+  }
 
-    x = match_recaff(cur + 1, &suff_feminine[i], remain, sep);
+  return best ? best - pst->pos : 0;
+}
 
-    if (x) {
-      return (int)(x - cur);
-    }
+/* 1ère, 17ème */
+int
+JFN(match_ordinal)(TParser* pst, int i)
+{
+  const TLexicon* lex = pst->lexicon;
+  uint32_t node = 0;
+  int start = i;
+  int best = start;
+  int next;
+
+  while (i < pst->strlen) {
+    node = lex_child(lex, node, jtowlower(JFN(read_composed)(pst, i, &next)));
+    if (!node || !(lex->nodes[node].prefix & LEX_ORDINAL))
+      return best - start;
+    i = next;
+    if (lex->nodes[node].term & LEX_ORDINAL)
+      best = i;
   }
-  return 0;
+
+  /* the string ends inside a suffix ("1è"): it's a match. */
+  return i - start;
 }
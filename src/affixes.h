@@ -1,6 +1,7 @@
 #ifndef AFFIXES_H
 #define AFFIXES_H
 
+#include "encoding.h"
 #include "parser.h"
 #include <stdlib.h>
 
@@ -16,27 +17,31 @@ typedef struct RecAffix
 
 } recaffix;
 
-/* prefixes is simplier, because have no optional parts. */
-typedef struct Affix
-{
-  jchar* str;
-  size_t len;
-} affix;
-
-/* match a recursive affix */
-jchar*
-match_recaff(jchar* str, const recaffix* affix, int max, jchar sep);
+/* match a recursive affix at index `i`. returns the index of the end
+ * of the match, or 0 (a match never ends at the start of the string).
+ */
+int
+JFN(match_recaff)(TParser* pst, int i, const recaffix* affix, jchar sep);
 
-/* match a simple affix */
-jchar*
-match_aff(jchar* str, const recaffix* affix, int max);
+/* match what can follow an affix (at index `i`): the end of the word,
+ * or one of its optional parts. */
+int
+JFN(match_opts)(TParser* pst,
+  int i,
+  const recaffix* const* opts,
+  int n_opts,
+  jchar sep);
 
 /* specific matching */
 int
-is_incl_suff(TParser* pst, jchar sep);
+JFN(is_incl_suff)(TParser* pst, jchar sep);
+int
+JFN(is_inversion)(TParser* pst);
 int
-is_inversion(TParser* pst);
+JFN(is_abbrev)(TParser* pst);
+
+/* the length of the ordinal suffix at index `i` (or 0) */
 int
-is_abbrev(TParser* pst);
+JFN(match_ordinal)(TParser* pst, int i);
 
 #endif
@@ -0,0 +1,80 @@
+#ifndef CHARTAB_H
+#define CHARTAB_H
+
+#include "parser.h"
+
+/* precomputed character tables (see tools/mkchartab.c).
+ *
+ * they replace `iswalpha`, `iswspace`, `towlower`, ... so the
+ * tokenization does not depend on the locale of the process, and
+ * does not call the libc for each character. the lookup is done in
+ * two levels: the high bits of the code point select a block of 256
+ * characters, the low bits the character in the block. the first
+ * block (ascii and latin-1) is read directly.
+ */
+
+/* code points above are neither letters, nor spaces, ... */
+#define JCH_MAX 0x110000
+
+/* character properties */
+#define JCH_ALPHA 0x01
+#define JCH_SPACE 0x02
+#define JCH_DIGIT 0x04
+#define JCH_CNTRL 0x08
+#define JCH_UPPER 0x10 /* cased letters */
+#define JCH_LOWER 0x20
+#define JCH_MARK 0x40  /* combining marks (JCH_ALPHA too): é in nfd */
+
+extern const unsigned char jch_ctype_index[JCH_MAX >> 8];
+extern const unsigned char jch_ctype_blocks[];
+extern const unsigned char jch_lower_index[JCH_MAX >> 8];
+extern const int jch_lower_blocks[];
+extern const unsigned char jch_fold_index[JCH_MAX >> 8];
+extern const unsigned short jch_fold_blocks[];
+
+static inline unsigned int
+jch_ctype(jchar c)
+{
+  if (c < 0x100)
+    return jch_ctype_blocks[c];
+  if (c >= JCH_MAX)
+    return 0;
+  return jch_ctype_blocks[(jch_ctype_index[c >> 8] << 8) | (c & 0xff)];
+}
+
+static inline jchar
+jtowlower(jchar c)
+{
+  if (c < 0x100)
+    return (jchar)((int)c + jch_lower_blocks[c]);
+  if (c >= JCH_MAX)
+    return c;
+  return (jchar)((int)c +
+                 jch_lower_blocks[(jch_lower_index[c >> 8] << 8) |
+                                  (c & 0xff)]);
+}
+
+/* a letter without its diacritics: one or two ascii letters (packed,
+ * the first one in the low byte: œ -> 'o' | 'e' << 8), or 0 if the
+ * character has no diacritics (or is not a letter). */
+static inline unsigned int
+jch_fold(jchar c)
+{
+  if (c < 0x80 || c >= JCH_MAX)
+    return 0;
+  return jch_fold_blocks[(jch_fold_index[c >> 8] << 8) | (c & 0xff)];
+}
+
+/* the combining diacritical marks (U+0300-U+036F): removed with the
+ * diacritics (NORM_UNACCENT) */
+#define jiswdiacritic(c) ((c) >= 0x300 && (c) <= 0x36f)
+
+#define jiswalpha(c) (jch_ctype(c) & JCH_ALPHA)
+#define jiswspace(c) (jch_ctype(c) & JCH_SPACE)
+#define jiswdigit(c) (jch_ctype(c) & JCH_DIGIT)
+#define jiswcntrl(c) (jch_ctype(c) & JCH_CNTRL)
+#define jiswalnum(c) (jch_ctype(c) & (JCH_ALPHA | JCH_DIGIT))
+#define jiswupper(c) (jch_ctype(c) & JCH_UPPER)
+#define jiswlower(c) (jch_ctype(c) & JCH_LOWER)
+
+#endif
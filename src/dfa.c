@@ -0,0 +1,128 @@
+/* the state machine lexer (see dfa.h). */
+
+#include "affixes.h"
+#include "dfa.h"
+#include "encoding.h"
+#include "lexicon.h"
+#include "parser.h"
+#include "probes.h"
+
+static int
+JFN(dfa_token)(TParser* pst)
+{
+  const TLexicon* lex = pst->lexicon;
+  int start = pst->pos;
+  int state;
+  int next;
+  int cl;
+  int i;
+  int len;
+  int end;
+  int ttype;
+
+  /* the end, and "-tu" after "penses" */
+  if (pst->pos >= pst->strlen || pst->_next != TS_START)
+    return JFN(get_token)(pst);
+
+  state = (pst->_prev == TS_SPACE) ? D_StartSp : D_Start;
+  end = start;
+  ttype = TS_START;
+  pst->tidx = start;
+
+  for (i = start;;) {
+    cl = (i < pst->strlen) ? dfa_class(JCH(pst, i)) : Cl_End;
+    next = dfa_next[state][cl];
+
+    if (next >= D_DOT) {
+      if (next == D_STOP)
+        break;
+      if (next == D_BAIL)
+        goto Bail;
+
+      /* the lexicon functions read the token from `pos` */
+      pst->pos = i;
+
+      if (next == D_DOT) {
+        /* auteur.rice */
+        if ((len = STAT_HIT(Stat_IsInclSuff, JFN(is_incl_suff)(pst, '.')))) {
+          state = (state == D_WordPar) ? D_WordPar : D_Word;
+          i += len;
+          end = i;
+          continue;
+        }
+        /* p. ex. */
+        if (STAT_HIT(Stat_IsAbbrev, JFN(is_abbrev)(pst))) {
+          end = i + 1;
+          ttype = TS_ABBREV;
+        }
+        break;
+      }
+
+      /* D_INV: penses-tu (the '-' is ascii, just before) */
+      pst->pos = i - 1;
+      if (STAT_HIT(Stat_IsInversion, JFN(is_inversion)(pst))) {
+        pst->_next = TS_WORD;
+        break;
+      }
+      state = (state == D_WordHyphenPar) ? D_WordPar : D_Word;
+      continue;
+    }
+
+    state = next;
+    i = JNEXT(pst, i);
+
+    /* plain letters don't change the state */
+    if (state == D_Word || state == D_WordPar)
+      i = JSKIP(pst, i, Scan_Alpha);
+
+    if (dfa_accept[state] != TS_START) {
+      end = i;
+      ttype = dfa_accept[state];
+    }
+  }
+
+  /* 17ème: the ordinal suffixes are in the lexicon. */
+  if (state == D_Num && cl != Cl_End) {
+    uint32_t node = lex_child(lex, 0, jtowlower(JCH(pst, i)));
+    if (node && (lex->nodes[node].prefix & LEX_ORDINAL))
+      goto Bail;
+  }
+
+  pst->pos = end;
+  pst->tlen = end - start;
+  pst->ttype = ttype;
+  pst->_prev = ttype;
+  STAT(Stat_DfaTokens);
+  STAT(Stat_Tokens);
+  STAT_ADD(Stat_Chars, pst->tlen);
+  PROBE_TOKEN(pst->tidx, pst->tlen, ttype);
+
+  return ttype;
+
+Bail:
+  STAT(Stat_DfaBails);
+  pst->pos = start;
+  return JFN(get_token)(pst);
+}
+
+/* with a maximum length, as `get_token`. */
+int
+JFN(get_token_dfa)(TParser* pst)
+{
+  int strlen = pst->strlen;
+  int ttype;
+
+  /* the table recognizes every token: the other options are parsed
+   * by `get_token` */
+  if (pst->opts != OPT_ALL)
+    return JFN(get_token)(pst);
+
+  if (pst->maxlen <= 0)
+    return JFN(dfa_token)(pst);
+
+  pst->strlen = token_end(pst);
+  ttype = JFN(dfa_token)(pst);
+  pst->strlen = strlen;
+
+  return ttype;
+}
@@ -0,0 +1,128 @@
+#ifndef DFA_H
+#define DFA_H
+
+#include "parser.h"
+#include "util.h"
+#include <stdint.h>
+
+/* a state machine lexer (see dfa.c), an alternative to the switch of
+ * `get_token`. each character is read once: its class selects the
+ * next state in a dense table (generated by tools/mkdfa.c). the token
+ * ends at the last accepting state. the lexicon is checked by the
+ * same functions as `get_token` (suffixes and abbreviations after a
+ * dot, inversions, ordinals), and the cases that need a lookahead of
+ * more than one character (emoticons, urls, arrows, ...) are given
+ * back to `get_token`, from the start of the token.
+ */
+
+/* character classes */
+enum DfaClass
+{
+  Cl_End = 0,    /* end of the string */
+  Cl_Nul,        /* \0 */
+  Cl_Blank,      /* ' ' */
+  Cl_Newline,    /* \n */
+  Cl_Space,      /* other spaces */
+  Cl_Cntrl,      /* control characters */
+  Cl_Alpha,      /* letters (but the ones below) */
+  Cl_K,          /* k (in numbers: 10k) */
+  Cl_X,          /* x (in numbers, and emoticons) */
+  Cl_XU,         /* X (emoticons) */
+  Cl_H,          /* h (http) */
+  Cl_W,          /* w (www.) */
+  Cl_WU,         /* W */
+  Cl_T,          /* t, T */
+  Cl_P,          /* p, P */
+  Cl_O,          /* o, v, ô (emoticons: o.o) */
+  Cl_Middot,     /* · */
+  Cl_Digit,      /* 0-9 */
+  Cl_DigitOther, /* other digits */
+  Cl_Dot,        /* . */
+  Cl_Strong,     /* ! ? */
+  Cl_Colon,      /* : ; */
+  Cl_Eq,         /* = */
+  Cl_Caret,      /* ^ */
+  Cl_Hyphen,     /* - */
+  Cl_NumSign,    /* / + * */
+  Cl_Open,       /* ( [ */
+  Cl_Brace,      /* { */
+  Cl_RParen,     /* ) */
+  Cl_Close,      /* ] } */
+  Cl_Gt,         /* > (arrows) */
+  Cl_Apos,       /* ' ’ ‘ */
+  Cl_Degree,     /* ° */
+  Cl_At,         /* @ */
+  Cl_Underscore, /* _ */
+  Cl_Mark,       /* combining marks: in a word, not at its start */
+  Cl_Punct,      /* other punctuation signs */
+  N_DFA_CLASSES,
+};
+
+/* states */
+enum DfaState
+{
+  D_Start = 0,
+  D_StartSp,     /* after a simple space */
+  D_Word,
+  D_WordPar,     /* in a word, after '(': autre(s) */
+  D_WordMid,     /* after '·' (not a token end) */
+  D_WordMidPar,
+  D_WordHyphen,  /* after '-' (not a token end) */
+  D_WordHyphenPar,
+  D_O,           /* o, v, ô: the first letter of a word */
+  D_H1,          /* h, ht, htt: the start of a word */
+  D_H2,
+  D_H3,
+  D_W1,          /* w, ww, www */
+  D_W2,
+  D_W3,
+  D_Num,
+  D_NumSign,     /* a number, after a sign: no ordinal */
+  D_Strong,
+  D_Ctrl,
+  D_Spaces,
+  D_Cite,
+  D_Colon,       /* : ; (not an emoticon) */
+  D_Hyphen,      /* - (not an arrow) */
+  D_FWord,       /* final states: the token ends there */
+  D_FAbbrev,
+  D_FPunct,
+  D_FSpace,
+  D_FNewline,
+  N_DFA_STATES,
+};
+
+/* transitions that are not states */
+#define D_DOT 0xfc  /* a dot in a word: suffix, abbreviation or end */
+#define D_INV 0xfd  /* a '-' and a letter: inversion, or a word */
+#define D_STOP 0xfe /* the token ends at the last accepting state */
+#define D_BAIL 0xff /* the token is parsed by `get_token` */
+
+extern const uint8_t dfa_classes[256];
+extern const uint8_t dfa_next[N_DFA_STATES][N_DFA_CLASSES];
+extern const int8_t dfa_accept[N_DFA_STATES]; /* token type, or -1 */
+
+static inline int
+dfa_class(jchar c)
+{
+  if (c < 0x100)
+    return dfa_classes[c];
+
+  if (c == L'’' || c == L'‘')
+    return Cl_Apos;
+
+  switch (getchtype(c)) {
+    case Ch_Space:
+      return Cl_Space;
+    case Ch_Word:
+      return Cl_Alpha;
+    case Ch_Digit:
+      return Cl_DigitOther;
+    case Ch_Ctrl:
+      return Cl_Cntrl;
+    default:
+      return (jch_ctype(c) & JCH_MARK) ? Cl_Mark : Cl_Punct;
+  }
+}
+
+#endif
@@ -0,0 +1,195 @@
+/* generated by tools/mkdfa.c -- do not edit. */
+
+#include "dfa.h"
+
+const uint8_t dfa_classes[256] = {
+   1,  5,  5,  5,  5,  5,  5,  5,  5,  4,  3,  4,  4,  4,  5,  5,
+   5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+   2, 20, 36, 36, 36, 36, 36, 31, 26, 28, 25, 25, 36, 24, 19, 25,
+  17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 21, 21, 36, 22, 30, 20,
+  33,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6, 15,
+  14,  6,  6,  6, 13,  6, 15, 12,  9,  6,  6, 26, 36, 29, 23, 34,
+  36,  6,  6,  6,  6,  6,  6,  6, 10,  6,  6,  7,  6,  6,  6, 15,
+  14,  6,  6,  6, 13,  6, 15, 11,  8,  6,  6, 27, 36, 29, 36,  5,
+   5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+   5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36,  6, 36, 36, 36, 36, 36,
+  32, 36, 36, 36, 36,  6, 36, 16, 36, 36,  6, 36, 36, 36, 36, 36,
+   6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+   6,  6,  6,  6, 15,  6,  6, 36,  6,  6,  6,  6,  6,  6,  6,  6,
+   6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+   6,  6,  6,  6, 15,  6,  6, 36,  6,  6,  6,  6,  6,  6,  6,  6,
+};
+
+const uint8_t dfa_next[N_DFA_STATES][N_DFA_CLASSES] = {
+  {
+    0xff, 0xff, 0x1a, 0x1b, 0x13, 0x12, 0x02, 0x02, 0xff, 0xff,
+    0x09, 0x0c, 0x02, 0x02, 0x02, 0x08, 0x19, 0x0f, 0x0f, 0x11,
+    0x11, 0x15, 0xff, 0xff, 0x16, 0x19, 0xff, 0x19, 0x19, 0x19,
+    0x19, 0x19, 0x19, 0x14, 0x19, 0x19, 0x19,
+  },
+  {
+    0xff, 0xff, 0x13, 0x1b, 0x13, 0x12, 0x02, 0x02, 0xff, 0xff,
+    0x09, 0x0c, 0x02, 0x02, 0x02, 0x08, 0x19, 0x0f, 0x0f, 0x11,
+    0x11, 0x15, 0xff, 0xff, 0x16, 0x19, 0xff, 0x19, 0x19, 0x19,
+    0x19, 0x19, 0x19, 0x14, 0x19, 0x19, 0x19,
+  },
+  {
+    0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x04, 0xfe, 0xfe, 0xfc,
+    0xfe, 0xfe, 0xfe, 0xfe, 0x06, 0xfe, 0x03, 0x03, 0xfe, 0xfe,
+    0xfe, 0x17, 0x18, 0xfe, 0xfe, 0x02, 0xfe,
+  },
+  {
+    0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x05, 0xfe, 0xfe, 0xfc,
+    0xfe, 0xfe, 0xfe, 0xfe, 0x07, 0xfe, 0x03, 0x03, 0x02, 0x02,
+    0xfe, 0x17, 0x18, 0xfe, 0xfe, 0x03, 0xfe,
+  },
+  {
+    0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xfe, 0xfe, 0xfe, 0xfe,
+    0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe,
+    0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0x02, 0xfe,
+  },
+  {
+    0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xfe, 0xfe, 0xfe, 0xfe,
+    0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe,
+    0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0x03, 0xfe,
+  },
+  {
+    0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfd, 0xfd, 0xfd, 0xfd,
+    0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfe, 0xfe, 0xfe, 0xfe,
+    0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe,
+    0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfd, 0xfe,
+  },
+  {
+    0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfd, 0xfd, 0xfd, 0xfd,
+    0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfe, 0xfe, 0xfe, 0xfe,
+    0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe,
+    0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfd, 0xfe,
+  },
+  {
+    0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x04, 0xfe, 0xfe, 0xff,
+    0xfe, 0xfe, 0xfe, 0xfe, 0x06, 0xfe, 0x03, 0x03, 0xfe, 0xfe,
+    0xfe, 0x17, 0x18, 0xfe, 0xff, 0x02, 0xfe,
+  },
+  {
+    0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x0a, 0x02, 0x02, 0x04, 0xfe, 0xfe, 0xfc,
+    0xfe, 0xfe, 0xfe, 0xfe, 0x06, 0xfe, 0x03, 0x03, 0xfe, 0xfe,
+    0xfe, 0x17, 0x18, 0xfe, 0xfe, 0x02, 0xfe,
+  },
+  {
+    0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x0b, 0x02, 0x02, 0x04, 0xfe, 0xfe, 0xfc,
+    0xfe, 0xfe, 0xfe, 0xfe, 0x06, 0xfe, 0x03, 0x03, 0xfe, 0xfe,
+    0xfe, 0x17, 0x18, 0xfe, 0xfe, 0x02, 0xfe,
+  },
+  {
+    0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0xff, 0x02, 0x04, 0xfe, 0xfe, 0xfc,
+    0xfe, 0xfe, 0xfe, 0xfe, 0x06, 0xfe, 0x03, 0x03, 0xfe, 0xfe,
+    0xfe, 0x17, 0x18, 0xfe, 0xfe, 0x02, 0xfe,
+  },
+  {
+    0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x0d, 0x0d, 0x02, 0x02, 0x02, 0x04, 0xfe, 0xfe, 0xfc,
+    0xfe, 0xfe, 0xfe, 0xfe, 0x06, 0xfe, 0x03, 0x03, 0xfe, 0xfe,
+    0xfe, 0x17, 0x18, 0xfe, 0xfe, 0x02, 0xfe,
+  },
+  {
+    0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x0e, 0x0e, 0x02, 0x02, 0x02, 0x04, 0xfe, 0xfe, 0xfc,
+    0xfe, 0xfe, 0xfe, 0xfe, 0x06, 0xfe, 0x03, 0x03, 0xfe, 0xfe,
+    0xfe, 0x17, 0x18, 0xfe, 0xfe, 0x02, 0xfe,
+  },
+  {
+    0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0x02, 0x02, 0x02, 0x02,
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x04, 0xfe, 0xfe, 0xff,
+    0xfe, 0xfe, 0xfe, 0xfe, 0x06, 0xfe, 0x03, 0x03, 0xfe, 0xfe,
+    0xfe, 0x17, 0x18, 0xfe, 0xfe, 0x02, 0xfe,
+  },
+  {
+    0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0x10, 0x10, 0xfe,
+    0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0x0f, 0xfe, 0x10,
+    0xfe, 0xfe, 0x10, 0x10, 0x10, 0x10, 0xfe, 0xfe, 0x10, 0xfe,
+    0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe,
+  },
+  {
+    0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0x10, 0x10, 0xfe,
+    0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0x0f, 0xfe, 0x10,
+    0xfe, 0xfe, 0x10, 0x10, 0x10, 0x10, 0xfe, 0xfe, 0x10, 0xfe,
+    0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe,
+  },
+  {
+    0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe,
+    0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0x11,
+    0x11, 0x11, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe,
+    0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe,
+  },
+  {
+    0xfe, 0x12, 0xfe, 0xfe, 0xfe, 0x12, 0xfe, 0xfe, 0xfe, 0xfe,
+    0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe,
+    0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe,
+    0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe,
+  },
+  {
+    0xfe, 0xfe, 0x13, 0x13, 0x13, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe,
+    0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe,
+    0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe,
+    0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe,
+  },
+  {
+    0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0x14, 0x14, 0x14, 0x14,
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0xfe,
+    0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe,
+    0xfe, 0xfe, 0xfe, 0xfe, 0x14, 0x14, 0xfe,
+  },
+  {
+    0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+    0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+  },
+  {
+    0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe,
+    0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe,
+    0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe,
+    0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe,
+  },
+  {
+    0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe,
+    0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe,
+    0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe,
+    0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe,
+  },
+  {
+    0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe,
+    0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe,
+    0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe,
+    0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe,
+  },
+  {
+    0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe,
+    0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe,
+    0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe,
+    0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe,
+  },
+  {
+    0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe,
+    0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe,
+    0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe,
+    0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe,
+  },
+  {
+    0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe,
+    0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe,
+    0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe,
+    0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe,
+  },
+};
+
+const int8_t dfa_accept[N_DFA_STATES] = { -1, -1, 2, 2, -1, -1, -1, -1, 2, 2, 2, 2, 2, 2, 2, 6, 6, 4, 10, 15, 8, 4, 5, 2, 11, 5, 1, 14, };
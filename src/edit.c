@@ -0,0 +1,212 @@
+#include "edit.h"
+#include "chartab.h"
+#include "stream.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define EDIT_BASE_SIZE 256
+
+/* move `n` tokens from `from` to `to` (the ranges can overlap), and
+ * shift their positions */
+static void
+move_tokens(TTokens* tokens, int to, int from, int n, int shift)
+{
+  size_t size = (size_t)n;
+
+  memmove(&tokens->start[to], &tokens->start[from], sizeof(uint32_t) * size);
+  memmove(&tokens->len[to], &tokens->len[from], sizeof(uint32_t) * size);
+  memmove(&tokens->type[to], &tokens->type[from], size);
+  memmove(&tokens->flags[to], &tokens->flags[from], size);
+
+  if (shift) {
+    for (int i = to; i < to + n; i++)
+      tokens->start[i] = (uint32_t)((int)tokens->start[i] + shift);
+  }
+}
+
+/* make the gap larger (the tokens after it are moved at the end) */
+static int
+grow(TEditTokens* et, int size)
+{
+  TTokens* t = &et->tokens;
+  int after = et->size - et->gap_end;
+  void* temp;
+
+  if (size <= et->size)
+    return 0;
+
+  if (!(temp = realloc(t->start, sizeof(uint32_t) * (size_t)size)))
+    return -1;
+  t->start = temp;
+  if (!(temp = realloc(t->len, sizeof(uint32_t) * (size_t)size)))
+    return -1;
+  t->len = temp;
+  if (!(temp = realloc(t->type, (size_t)size)))
+    return -1;
+  t->type = temp;
+  if (!(temp = realloc(t->flags, (size_t)size)))
+    return -1;
+  t->flags = temp;
+
+  move_tokens(t, size - after, et->gap_end, after, 0);
+  et->gap_end = size - after;
+  et->size = size;
+
+  return 0;
+}
+
+/* move the gap before the i-th token */
+static void
+move_gap(TEditTokens* et, int i)
+{
+  int n;
+
+  if (i < et->gap) {
+    n = et->gap - i;
+    move_tokens(&et->tokens, et->gap_end - n, i, n, -et->shift);
+    et->gap -= n;
+    et->gap_end -= n;
+  } else if (i > et->gap) {
+    n = i - et->gap;
+    move_tokens(&et->tokens, et->gap, et->gap_end, n, et->shift);
+    et->gap += n;
+    et->gap_end += n;
+  }
+}
+
+/* the index of the token that starts at `pos`, or -1 */
+static int
+find_token(const TEditTokens* et, int pos)
+{
+  int lo = 0;
+  int hi = edit_tokens_len(et);
+
+  while (lo < hi) {
+    int mid = lo + (hi - lo) / 2;
+    if ((int)edit_token_start(et, mid) < pos)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+
+  return (lo < edit_tokens_len(et) && (int)edit_token_start(et, lo) == pos)
+           ? lo
+           : -1;
+}
+
+int
+tokenize_edit(TParser* pst, TEditTokens* et)
+{
+  /* there are never more tokens than characters */
+  et->gap = 0;
+  et->gap_end = et->size;
+  et->shift = 0;
+  if (grow(et, pst->strlen + 1))
+    return -1;
+
+  /* the flags of the tokens are checked against every token */
+  pst->types = TYPES_ALL;
+  et->gap = get_tokens(pst, &et->tokens, et->size);
+
+  return et->gap;
+}
+
+void
+free_edit_tokens(TEditTokens* et)
+{
+  free(et->tokens.start);
+  free(et->tokens.len);
+  free(et->tokens.type);
+  free(et->tokens.flags);
+  memset(et, 0, sizeof(TEditTokens));
+}
+
+int
+retokenize(TParser* pst,
+  TEditTokens* et,
+  int offset,
+  int deleted,
+  int inserted)
+{
+  TTokens* t = &et->tokens;
+  int shift = inserted - deleted;
+  int end = offset + inserted; /* the end of the edit, in the new text */
+  int resync, first;
+
+  /* the text is the same before `offset`, and no token looks further
+   * than the next space: the tokens before a safe point are kept. */
+  resync = find_resync(pst->str, 1, offset);
+  first = resync ? find_token(et, resync) : 0;
+  if (first < 0) {
+    resync = 0;
+    first = 0;
+  }
+  move_gap(et, first);
+
+  /* the state of the parser at the safe point (after a space) */
+  pst->types = TYPES_ALL;
+  pst->pos = resync;
+  pst->_next = TS_START;
+  pst->_prev = first ? t->type[first - 1] : TS_START;
+  pst->_sent = 1;
+  for (int i = first - 1; i >= 0; i--) {
+    if (t->type[i] != TS_SPACE) {
+      pst->_sent = ENDS_SENTENCE(t->type[i]);
+      break;
+    }
+  }
+
+  /* the new tokens are written in the gap, and compared with the old
+   * ones, after the gap (their positions are in the old text). */
+  for (;;) {
+    TTokens one;
+    int pos, old;
+
+    if (et->gap == et->gap_end &&
+        grow(et, et->size ? 2 * et->size : EDIT_BASE_SIZE))
+      return -1;
+
+    one.start = &t->start[et->gap];
+    one.len = &t->len[et->gap];
+    one.type = &t->type[et->gap];
+    one.flags = &t->flags[et->gap];
+    one.hash = NULL;
+    one.lhash = NULL;
+    one.shape = NULL;
+    if (!get_tokens(pst, &one, 1))
+      break;
+    et->gap++;
+
+    /* the old token at the same position (after the edit) */
+    pos = pst->pos;
+    if (pos <= end || pos >= pst->strlen)
+      continue;
+    while (et->gap_end < et->size &&
+           (int)t->start[et->gap_end] + et->shift < pos - shift)
+      et->gap_end++;
+    if (et->gap_end == et->size)
+      continue;
+    old = et->gap_end;
+    if ((int)t->start[old] + et->shift != pos - shift)
+      continue;
+
+    /* it starts at a safe point, and the parser would give it the same
+     * flags: the next tokens are the same. */
+    if (jiswspace(pst->str[pos - 1]) && !jiswspace(pst->str[pos]) &&
+        pst->_next == TS_START) {
+      int flags = (pst->_prev == TS_SPACE) ? TF_SPACEBEFORE : 0;
+      if (pst->_sent && !ENDS_SENTENCE(t->type[old]))
+        flags |= TF_SENTSTART;
+      if (flags == t->flags[old]) {
+        et->shift += shift;
+        return edit_tokens_len(et);
+      }
+    }
+  }
+
+  /* the end of the text: no old token is left */
+  et->gap_end = et->size;
+  et->shift = 0;
+
+  return edit_tokens_len(et);
+}
@@ -0,0 +1,73 @@
+#ifndef EDIT_H
+#define EDIT_H
+
+#include "parser.h"
+
+/* incremental tokenization, for a text that is edited: after an edit
+ * (some characters deleted at an offset, and others inserted), only
+ * the tokens around the edit are parsed again. the parser starts at
+ * the last safe point before the edit (see `find_resync` in stream.h),
+ * and stops as soon as its tokens are the same as the old ones after
+ * the edit: a token that starts at a safe point, with the same flags.
+ *
+ * the tokens are kept in a gap buffer, as the text of an editor: the
+ * free space is at the last edit, and the positions of the tokens
+ * after it are shifted lazily (`shift`). an edit only moves the tokens
+ * between the last edit and this one, so its time depends on the
+ * length of the edit (and of the tokens around it), not on the length
+ * of the text.
+ *
+ * the tokens are the same as with `get_tokens` on the whole new text.
+ * code points only (not utf-8), without the normalized forms (and the
+ * hashes, and the shapes).
+ */
+typedef struct
+{
+  TTokens tokens; // the tokens: [0, gap) and [gap_end, size)
+  int size;       // allocated size of the arrays
+  int gap;        // the first free index
+  int gap_end;    // the first token after the gap
+  int shift;      // added to the positions of the tokens after the gap
+} TEditTokens;
+
+// tokenize the whole text of a parser (initialized by `init_parser`,
+// with its settings, but the filter of types: every token is kept).
+// the buffer starts zeroed, and can be reused.
+// returns the number of tokens, or -1 if memory can't be allocated.
+int tokenize_edit(TParser* pst, TEditTokens* et);
+void free_edit_tokens(TEditTokens* et);
+
+// re-tokenize the text of the parser after an edit: `inserted`
+// characters at `offset` replaced `deleted` characters. the parser
+// holds the new text (`init_parser`, with the same settings). returns
+// the number of tokens, or -1 if memory can't be allocated.
+int retokenize(TParser* pst,
+  TEditTokens* et,
+  int offset,
+  int deleted,
+  int inserted);
+
+// the number of tokens
+static inline int
+edit_tokens_len(const TEditTokens* et)
+{
+  return et->gap + et->size - et->gap_end;
+}
+
+// the index of the i-th token in the arrays
+static inline int
+edit_token(const TEditTokens* et, int i)
+{
+  return (i < et->gap) ? i : i + et->gap_end - et->gap;
+}
+
+// the position of the i-th token in the text
+static inline uint32_t
+edit_token_start(const TEditTokens* et, int i)
+{
+  if (i < et->gap)
+    return et->tokens.start[i];
+  return (uint32_t)((int)et->tokens.start[edit_token(et, i)] + et->shift);
+}
+
+#endif
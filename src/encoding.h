@@ -0,0 +1,243 @@
+#ifndef ENCODING_H
+#define ENCODING_H
+
+#include "chartab.h"
+#include "parser.h"
+#include "scan.h"
+#include "stats.h"
+#include <limits.h>
+#include <stdlib.h>
+
+/* the parser is compiled twice from the same sources: for strings of
+ * code points (`jchar*`, the default), and for utf-8 strings, when
+ * JUSQUCI_UTF8 is defined (see parser_utf8.c). positions and lengths
+ * (pos, tidx, tlen, strlen) are counted in code units: characters or
+ * bytes. the parser never does arithmetic on positions, except after
+ * an ascii character (which is a single byte in utf-8): it uses these
+ * macros to read the character at a position (JCH), or to go to the
+ * next (JNEXT) or the previous (JPREV) character. JSKIP skips a run
+ * of ascii characters (see scan.h).
+ */
+
+/* the name of a function, with a suffix (a variant, see token.c) */
+#define JCAT(name, suffix) JCAT_(name, suffix)
+#define JCAT_(name, suffix) name##suffix
+
+/* is there a character at index `i`, before the end of the string?
+ * with a padded string (JUSQUCI_PADDED, see token_pad.c), the loops
+ * stop on the '\0' after the end instead: it's always true, and the
+ * scans (JSKIP) read whole blocks, up to the first character that is
+ * not in the run. */
+#ifdef JUSQUCI_PADDED
+#define JMORE(pst, i) 1
+#define JEND(pst) (INT_MAX - JUSQUCI_PAD)
+#else
+#define JMORE(pst, i) ((i) < (pst)->strlen)
+#define JEND(pst) ((pst)->strlen)
+#endif
+
+#ifdef JUSQUCI_UTF8
+
+#define JFN(name) JCAT(name, _utf8)
+#define JSTR(pst) ((const unsigned char*)(pst)->_str)
+#define JNEXT(pst, i) ((i) + utf8_width(pst, i))
+#define JPREV(pst, i) utf8_prev(pst, i)
+#define JSKIP(pst, i, kind)                                                 \
+  JSKIPPED(i, skip_run8(JSTR(pst), i, JEND(pst), kind))
+#ifdef JUSQUCI_STATS
+#define JCH(pst, i) utf8_read(pst, i)
+#else
+#define JCH(pst, i) utf8_decode(pst, i)
+#endif
+
+/* length of the utf-8 sequence at index `i`. invalid (or truncated)
+ * sequences are read as single characters (U+FFFD), and so is the end
+ * of the string (the string is not read after its end: it might not
+ * be followed by a '\0'). */
+static inline int
+utf8_width(const TParser* pst, int i)
+{
+  const unsigned char* s = JSTR(pst) + i;
+  int n;
+
+  if (!JMORE(pst, i))
+    return 1;
+
+  if (s[0] < 0x80)
+    return 1;
+  else if (s[0] >= 0xc2 && s[0] <= 0xdf)
+    n = 2;
+  else if (s[0] >= 0xe0 && s[0] <= 0xef)
+    n = 3;
+  else if (s[0] >= 0xf0 && s[0] <= 0xf4)
+    n = 4;
+  else
+    return 1;
+
+  if (!JMORE(pst, i + n - 1))
+    return 1;
+
+  for (int k = 1; k < n; k++) {
+    if ((s[k] & 0xc0) != 0x80)
+      return 1;
+  }
+
+  /* overlong forms, surrogates and code points above U+10FFFF */
+  if ((s[0] == 0xe0 && s[1] < 0xa0) || (s[0] == 0xed && s[1] > 0x9f) ||
+      (s[0] == 0xf0 && s[1] < 0x90) || (s[0] == 0xf4 && s[1] > 0x8f))
+    return 1;
+
+  return n;
+}
+
+/* the character at index `i` (0 after the end of the string). */
+static inline jchar
+utf8_decode(const TParser* pst, int i)
+{
+  const unsigned char* s = JSTR(pst) + i;
+
+  if (!JMORE(pst, i))
+    return 0;
+
+  if (s[0] < 0x80)
+    return s[0];
+
+  switch (utf8_width(pst, i)) {
+    case 2:
+      return (jchar)((s[0] & 0x1f) << 6 | (s[1] & 0x3f));
+    case 3:
+      return (jchar)((s[0] & 0x0f) << 12 | (s[1] & 0x3f) << 6 |
+                     (s[2] & 0x3f));
+    case 4:
+      return (jchar)((s[0] & 0x07) << 18 | (s[1] & 0x3f) << 12 |
+                     (s[2] & 0x3f) << 6 | (s[3] & 0x3f));
+    default:
+      return 0xfffd;
+  }
+}
+
+/* index of the character before index `i`. */
+static inline int
+utf8_prev(const TParser* pst, int i)
+{
+  const unsigned char* s = JSTR(pst);
+  int j = i - 1;
+
+  while (j > 0 && j > i - 4 && (s[j] & 0xc0) == 0x80)
+    j--;
+
+  if (j + utf8_width(pst, j) == i)
+    return j;
+
+  return i - 1;
+}
+
+#ifdef JUSQUCI_STATS
+/* the same as `utf8_decode`, and count the bytes read (stats.h). */
+static inline jchar
+utf8_read(const TParser* pst, int i)
+{
+  if (i < pst->strlen)
+    STAT_ADD(Stat_Reads, utf8_width(pst, i));
+  return utf8_decode(pst, i);
+}
+#endif
+
+#else
+
+#define JFN(name) name
+#define JSTR(pst) ((pst)->str)
+#define JNEXT(pst, i) ((i) + 1)
+#define JPREV(pst, i) ((i) - 1)
+#define JSKIP(pst, i, kind)                                                 \
+  JSKIPPED(i, skip_run32((pst)->str, i, JEND(pst), kind))
+#ifdef JUSQUCI_STATS
+#define JCH(pst, i) (STAT(Stat_Reads), (pst)->str[i])
+#else
+#define JCH(pst, i) ((pst)->str[i])
+#endif
+
+#endif
+
+/* write a character (a valid code point) in utf-8. returns its length
+ * (at most 4 bytes). */
+static inline int
+utf8_encode(jchar c, unsigned char* s)
+{
+  if (c < 0x80) {
+    s[0] = (unsigned char)c;
+    return 1;
+  } else if (c < 0x800) {
+    s[0] = (unsigned char)(0xc0 | c >> 6);
+    s[1] = (unsigned char)(0x80 | (c & 0x3f));
+    return 2;
+  } else if (c < 0x10000) {
+    s[0] = (unsigned char)(0xe0 | c >> 12);
+    s[1] = (unsigned char)(0x80 | (c >> 6 & 0x3f));
+    s[2] = (unsigned char)(0x80 | (c & 0x3f));
+    return 3;
+  }
+  s[0] = (unsigned char)(0xf0 | c >> 18);
+  s[1] = (unsigned char)(0x80 | (c >> 12 & 0x3f));
+  s[2] = (unsigned char)(0x80 | (c >> 6 & 0x3f));
+  s[3] = (unsigned char)(0x80 | (c & 0x3f));
+  return 4;
+}
+
+/* the characters skipped by JSKIP are read too (stats.h) */
+#ifdef JUSQUCI_STATS
+#define JSKIPPED(i, end) stat_skipped(i, end)
+static inline int
+stat_skipped(int i, int end)
+{
+  STAT_ADD(Stat_Reads, end - i);
+  return end;
+}
+#else
+#define JSKIPPED(i, end) (end)
+#endif
+
+/* compare the string at index `i` (any case) with a lowercase string
+ * (\0 terminated), up to index `end`. returns the length of the
+ * matched part (in code units), or 0. */
+static inline int
+cmpi(const TParser* pst, int i, int end, const jchar* s_lowercase)
+{
+  int start = i;
+
+  for (; i < end; i = JNEXT(pst, i)) {
+    if (*s_lowercase == L'\0')
+      break;
+    if (jtowlower(JCH(pst, i)) != *s_lowercase++)
+      return 0;
+  }
+
+  return i - start;
+}
+
+/* the end of the string, as seen by the parser for a token that starts
+ * at `pos`: no further than `maxlen` (see parser.h), at the start of
+ * a character, and after the first character. */
+static inline int
+token_end(const TParser* pst)
+{
+  int end;
+
+  if (pst->maxlen <= 0 || pst->strlen - pst->pos <= pst->maxlen)
+    return pst->strlen;
+
+  end = pst->pos + pst->maxlen;
+#ifdef JUSQUCI_UTF8
+  for (int k = 0; k < 3 && end > pst->pos; k++) {
+    if ((JSTR(pst)[end] & 0xc0) != 0x80)
+      break;
+    end--;
+  }
+  if (end <= pst->pos)
+    end = JNEXT(pst, pst->pos);
+#endif
+
+  return end;
+}
+
+#endif
@@ -0,0 +1,147 @@
+#ifndef HASH_H
+#define HASH_H
+
+#include "parser.h"
+#include <stddef.h>
+#include <stdint.h>
+
+/* 64-bit hashes of the tokens (HASH_*, see parser.h), on their utf-8
+ * bytes. they are written by the parser, once a token is parsed (its
+ * characters are still in cache), from its characters: a token is
+ * written in utf-8 in a small buffer (and lowercase in another one),
+ * then hashed by blocks. the bytes of a longer token are given one at
+ * a time.
+ *
+ * HASH_MURMUR is murmurhash64a (austin appleby), with the seed 1: the
+ * hash of spacy (`hash_string`, the keys of its StringStore), so the
+ * hashes can be used as they are with spacy's tables. it's read by
+ * blocks of 8 bytes (little-endian), and it starts with the length of
+ * the string: it's known before the first byte. HASH_FNV is fnv-1a,
+ * 64 bits: a bit faster, and the length is not needed.
+ */
+
+#define MURMUR_M 0xc6a4a7935bd1e995ull
+#define MURMUR_R 47
+#define MURMUR_SEED 1
+#define FNV_OFFSET 14695981039346656037ull
+#define FNV_PRIME 1099511628211ull
+
+/* the tokens hashed by blocks, from a buffer (in utf-8 bytes) */
+#define HASH_BUF_SIZE 128
+
+typedef struct
+{
+  int kind;       /* HASH_* */
+  uint64_t h;     /* the hash */
+  uint64_t block; /* the current block (murmurhash) */
+  int n;          /* its length */
+} THash;
+
+/* start a hash, for a string of `len` bytes */
+static inline void
+hash_init(THash* st, int kind, size_t len)
+{
+  st->kind = kind;
+  st->block = 0;
+  st->n = 0;
+  if (kind == HASH_FNV)
+    st->h = FNV_OFFSET;
+  else
+    st->h = MURMUR_SEED ^ ((uint64_t)len * MURMUR_M);
+}
+
+/* a block of 8 bytes (murmurhash) */
+static inline void
+hash_block(THash* st, uint64_t k)
+{
+  k *= MURMUR_M;
+  k ^= k >> MURMUR_R;
+  k *= MURMUR_M;
+  st->h = (st->h ^ k) * MURMUR_M;
+}
+
+static inline void
+hash_byte(THash* st, unsigned char b)
+{
+  if (st->kind == HASH_FNV) {
+    st->h = (st->h ^ b) * FNV_PRIME;
+    return;
+  }
+
+  st->block |= (uint64_t)b << (8 * st->n);
+  if (++st->n < 8)
+    return;
+
+  hash_block(st, st->block);
+  st->block = 0;
+  st->n = 0;
+}
+
+static inline uint64_t
+hash_final(THash* st)
+{
+  uint64_t h = st->h;
+
+  if (st->kind == HASH_FNV)
+    return h;
+
+  /* the last bytes (less than a block) */
+  if (st->n)
+    h = (h ^ st->block) * MURMUR_M;
+
+  h ^= h >> MURMUR_R;
+  h *= MURMUR_M;
+  h ^= h >> MURMUR_R;
+
+  return h;
+}
+
+/* the hash of a whole string */
+static inline uint64_t
+hash_bytes(int kind, const unsigned char* s, size_t len)
+{
+  THash st;
+  size_t i = 0;
+
+  hash_init(&st, kind, len);
+  if (kind == HASH_FNV) {
+    for (; i < len; i++)
+      st.h = (st.h ^ s[i]) * FNV_PRIME;
+    return st.h;
+  }
+
+  for (; i + 8 <= len; i += 8)
+    hash_block(&st,
+      (uint64_t)s[i] | (uint64_t)s[i + 1] << 8 | (uint64_t)s[i + 2] << 16 |
+        (uint64_t)s[i + 3] << 24 | (uint64_t)s[i + 4] << 32 |
+        (uint64_t)s[i + 5] << 40 | (uint64_t)s[i + 6] << 48 |
+        (uint64_t)s[i + 7] << 56);
+  /* the last bytes (as in murmurhash64a) */
+  st.n = (int)(len & 7);
+  switch (st.n) {
+    case 7:
+      st.block |= (uint64_t)s[i + 6] << 48;
+      /* fall through */
+    case 6:
+      st.block |= (uint64_t)s[i + 5] << 40;
+      /* fall through */
+    case 5:
+      st.block |= (uint64_t)s[i + 4] << 32;
+      /* fall through */
+    case 4:
+      st.block |= (uint64_t)s[i + 3] << 24;
+      /* fall through */
+    case 3:
+      st.block |= (uint64_t)s[i + 2] << 16;
+      /* fall through */
+    case 2:
+      st.block |= (uint64_t)s[i + 1] << 8;
+      /* fall through */
+    case 1:
+      st.block |= (uint64_t)s[i];
+  }
+
+  return hash_final(&st);
+}
+
+#endif
@@ -0,0 +1,97 @@
+#include "large.h"
+#include "chartab.h"
+#include "stream.h"
+
+/* the last safe point of a utf-8 text, as `find_resync`, between two
+ * ascii characters (there are fewer safe points: the other spaces, and
+ * the other characters after a space, are not checked). returns 0 if
+ * there is none. */
+static int
+find_resync_utf8(const unsigned char* s, int start, int end)
+{
+  if (start < 1)
+    start = 1;
+
+  for (int i = end - 1; i >= start; i--) {
+    if (s[i - 1] < 0x80 && jiswspace(s[i - 1]) && s[i] < 0x80 &&
+        !jiswspace(s[i]))
+      return i;
+  }
+
+  return 0;
+}
+
+/* move the window to the position of the parser: it ends at the last
+ * safe point before its maximum length (or at the end of the text).
+ * the parser keeps its state (`_prev`, `_next`, `_sent`). */
+static void
+move_window(TLarge* lt)
+{
+  TParser* pst = &lt->pst;
+  int64_t remain;
+  int len, safe;
+
+  lt->base += pst->pos;
+  remain = lt->len - lt->base;
+  len = (remain > lt->window) ? lt->window : (int)remain;
+
+  if (lt->utf8) {
+    unsigned char* s = (unsigned char*)lt->text + lt->base;
+
+    pst->_str = (char*)s;
+    safe = (len < remain) ? find_resync_utf8(s, 1, len) : len;
+
+    /* no safe point: the window is cut between two characters */
+    while (!safe && len > 1 && (s[len] & 0xc0) == 0x80)
+      len--;
+  } else {
+    jchar* s = (jchar*)lt->text + lt->base;
+
+    pst->str = s;
+    safe = (len < remain) ? find_resync(s, 1, len) : len;
+  }
+
+  pst->pos = 0;
+  pst->strlen = safe ? safe : len;
+}
+
+void
+init_large(TLarge* lt, jchar* text, int64_t len)
+{
+  /* the first window is set by the first call (see `window`) */
+  init_parser(&lt->pst, text, 0);
+  lt->text = text;
+  lt->len = len;
+  lt->base = 0;
+  lt->window = LARGE_WINDOW;
+  lt->utf8 = 0;
+}
+
+void
+init_large_utf8(TLarge* lt, char* text, int64_t len)
+{
+  init_parser_utf8(&lt->pst, text, 0);
+  lt->text = text;
+  lt->len = len;
+  lt->base = 0;
+  lt->window = LARGE_WINDOW;
+  lt->utf8 = 1;
+}
+
+int
+get_large_tokens(TLarge* lt, TTokens* out, TNorms* norms, int capacity)
+{
+  TParser* pst = &lt->pst;
+  int n;
+
+  for (;;) {
+    n = lt->utf8 ? get_tokens_norm_utf8(pst, out, norms, capacity)
+                 : get_tokens_norm(pst, out, norms, capacity);
+
+    /* tokens, or the end of the text (a '\0' too), or a full arena */
+    if (n || pst->pos < pst->strlen || lt->base + pst->strlen >= lt->len)
+      return n;
+
+    move_window(lt);
+  }
+}
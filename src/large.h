@@ -0,0 +1,45 @@
+#ifndef LARGE_H
+#define LARGE_H
+
+#include "parser.h"
+
+/* texts longer than the positions of the parser (`int`: 2^31 code
+ * units), such as a corpus in a memory-mapped file. the parser sees a
+ * window of the text, that ends at a safe point (see `find_resync`),
+ * and that moves forward once it's parsed: the tokens are the same as
+ * with `get_tokens` on the whole text, and the text is not copied.
+ * the positions in the text are 64-bit: the window starts at `base`.
+ *
+ * the parser, and the columns of the tokens (TTokens), keep their
+ * 32-bit positions: nothing is added for each token, only the search
+ * of the last safe point of each window (once every LARGE_WINDOW code
+ * units). a window without any safe point (a sequence of non-space
+ * characters longer than the window) is cut at its end, as with a
+ * maximum length of tokens.
+ */
+
+// the maximum length of a window, by default (in code units)
+#define LARGE_WINDOW (1 << 30)
+
+typedef struct
+{
+  TParser pst;  // parses the window (its settings can be changed)
+  void* text;   // the whole text: code points, or utf-8 bytes
+  int64_t len;  // its length (in code units)
+  int64_t base; // the position of the window in the text
+  int window;   // the maximum length of a window (LARGE_WINDOW)
+  int utf8;     // the text is in utf-8
+} TLarge;
+
+// start a text, of code points or of utf-8 bytes.
+void init_large(TLarge* lt, jchar* text, int64_t len);
+void init_large_utf8(TLarge* lt, char* text, int64_t len);
+
+// get the next tokens (and their normalized forms, with `norms`), like
+// `get_tokens_norm`: 0 at the end of the text (or when the arena is
+// full). the positions of the tokens are in the window: their
+// positions in the text are `lt->base + start`. the window only moves
+// before the first token of a batch.
+int get_large_tokens(TLarge* lt, TTokens* out, TNorms* norms, int capacity);
+
+#endif
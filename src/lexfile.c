@@ -0,0 +1,79 @@
+/* lexicon files (see lexicon.h). */
+
+#include "lexicon.h"
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/* the nodes and edges must stay inside the arrays: a lexicon file is
+ * not trusted more than a text. */
+static int
+check_lexicon(const TLexicon* lex)
+{
+  for (uint32_t i = 0; i < lex->n_nodes; i++) {
+    if (lex->nodes[i].first > lex->n_edges ||
+        lex->nodes[i].n > lex->n_edges - lex->nodes[i].first)
+      return 0;
+  }
+
+  for (uint32_t i = 0; i < lex->n_edges; i++) {
+    if (!lex->edges[i].node || lex->edges[i].node >= lex->n_nodes)
+      return 0;
+  }
+
+  return 1;
+}
+
+int
+load_lexicon(TLexicon* lex, const char* path)
+{
+  const lexheader* h;
+  struct stat st;
+  void* map;
+  int fd;
+
+  if ((fd = open(path, O_RDONLY)) < 0)
+    return -1;
+
+  if (fstat(fd, &st) || (size_t)st.st_size < sizeof(lexheader)) {
+    close(fd);
+    return -1;
+  }
+
+  map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (map == MAP_FAILED)
+    return -1;
+
+  h = map;
+  lex->_map = map;
+  lex->_size = (size_t)st.st_size;
+  lex->n_nodes = h->n_nodes;
+  lex->n_edges = h->n_edges;
+  lex->nodes = (const lexnode*)(h + 1);
+  lex->edges = (const lexedge*)(lex->nodes + h->n_nodes);
+
+  if (memcmp(h->magic, LEX_MAGIC, sizeof(LEX_MAGIC)) ||
+      h->version != LEX_VERSION || h->byteorder != LEX_BYTEORDER ||
+      !h->n_nodes || h->n_nodes > lex->_size / sizeof(lexnode) ||
+      h->n_edges > lex->_size / sizeof(lexedge) ||
+      lex->_size != sizeof(lexheader) + sizeof(lexnode) * h->n_nodes +
+                      sizeof(lexedge) * h->n_edges ||
+      !check_lexicon(lex)) {
+    free_lexicon(lex);
+    return -1;
+  }
+
+  return 0;
+}
+
+void
+free_lexicon(TLexicon* lex)
+{
+  if (lex->_map)
+    munmap(lex->_map, lex->_size);
+
+  memset(lex, 0, sizeof(TLexicon));
+}
@@ -0,0 +1,257 @@
+/* generated by tools/mklexicon.c -- do not edit. */
+
+#include "lexicon.h"
+
+static const lexnode nodes[120] = {
+  { 0, 21, 0x0f, 0x00 },
+  { 21, 7, 0x0f, 0x09 },
+  { 28, 5, 0x07, 0x02 },
+  { 33, 2, 0x09, 0x00 },
+  { 35, 4, 0x03, 0x00 },
+  { 39, 1, 0x01, 0x00 },
+  { 40, 2, 0x05, 0x00 },
+  { 42, 2, 0x03, 0x00 },
+  { 44, 2, 0x03, 0x00 },
+  { 46, 1, 0x01, 0x00 },
+  { 47, 2, 0x05, 0x00 },
+  { 49, 1, 0x02, 0x00 },
+  { 50, 4, 0x02, 0x00 },
+  { 54, 3, 0x06, 0x00 },
+  { 57, 4, 0x06, 0x02 },
+  { 61, 1, 0x02, 0x00 },
+  { 62, 0, 0x02, 0x02 },
+  { 62, 2, 0x04, 0x00 },
+  { 64, 2, 0x04, 0x00 },
+  { 66, 1, 0x04, 0x00 },
+  { 67, 1, 0x04, 0x00 },
+  { 68, 0, 0x08, 0x08 },
+  { 68, 2, 0x03, 0x00 },
+  { 70, 2, 0x01, 0x00 },
+  { 72, 1, 0x02, 0x00 },
+  { 73, 1, 0x06, 0x02 },
+  { 74, 0, 0x04, 0x04 },
+  { 74, 0, 0x04, 0x04 },
+  { 74, 0, 0x08, 0x08 },
+  { 74, 1, 0x05, 0x01 },
+  { 75, 1, 0x01, 0x00 },
+  { 76, 0, 0x02, 0x02 },
+  { 76, 1, 0x02, 0x00 },
+  { 77, 1, 0x04, 0x00 },
+  { 78, 1, 0x09, 0x00 },
+  { 79, 1, 0x08, 0x00 },
+  { 80, 2, 0x03, 0x00 },
+  { 82, 1, 0x01, 0x00 },
+  { 83, 1, 0x02, 0x02 },
+  { 84, 1, 0x02, 0x00 },
+  { 85, 1, 0x01, 0x00 },
+  { 86, 1, 0x05, 0x04 },
+  { 87, 1, 0x04, 0x00 },
+  { 88, 0, 0x01, 0x01 },
+  { 88, 1, 0x02, 0x00 },
+  { 89, 1, 0x01, 0x00 },
+  { 90, 0, 0x02, 0x02 },
+  { 90, 0, 0x01, 0x01 },
+  { 90, 0, 0x01, 0x01 },
+  { 90, 1, 0x04, 0x00 },
+  { 91, 0, 0x02, 0x02 },
+  { 91, 0, 0x02, 0x02 },
+  { 91, 1, 0x02, 0x00 },
+  { 92, 2, 0x02, 0x02 },
+  { 94, 0, 0x02, 0x02 },
+  { 94, 1, 0x06, 0x02 },
+  { 95, 0, 0x02, 0x02 },
+  { 95, 1, 0x04, 0x04 },
+  { 96, 1, 0x02, 0x00 },
+  { 97, 1, 0x04, 0x00 },
+  { 98, 1, 0x04, 0x00 },
+  { 99, 0, 0x04, 0x04 },
+  { 99, 1, 0x02, 0x00 },
+  { 100, 0, 0x04, 0x04 },
+  { 100, 0, 0x04, 0x04 },
+  { 100, 1, 0x04, 0x00 },
+  { 101, 0, 0x04, 0x04 },
+  { 101, 0, 0x04, 0x04 },
+  { 101, 1, 0x04, 0x00 },
+  { 102, 1, 0x01, 0x00 },
+  { 103, 0, 0x02, 0x02 },
+  { 103, 0, 0x01, 0x01 },
+  { 103, 1, 0x01, 0x00 },
+  { 104, 1, 0x02, 0x00 },
+  { 105, 0, 0x04, 0x04 },
+  { 105, 0, 0x04, 0x04 },
+  { 105, 1, 0x01, 0x00 },
+  { 106, 0, 0x02, 0x02 },
+  { 106, 0, 0x04, 0x04 },
+  { 106, 0, 0x09, 0x09 },
+  { 106, 0, 0x08, 0x08 },
+  { 106, 0, 0x01, 0x01 },
+  { 106, 0, 0x02, 0x02 },
+  { 106, 0, 0x01, 0x01 },
+  { 106, 0, 0x02, 0x02 },
+  { 106, 1, 0x02, 0x02 },
+  { 107, 1, 0x01, 0x00 },
+  { 108, 0, 0x01, 0x01 },
+  { 108, 0, 0x04, 0x04 },
+  { 108, 1, 0x02, 0x00 },
+  { 109, 1, 0x01, 0x00 },
+  { 110, 0, 0x04, 0x04 },
+  { 110, 0, 0x02, 0x02 },
+  { 110, 1, 0x02, 0x00 },
+  { 111, 0, 0x02, 0x02 },
+  { 111, 0, 0x04, 0x04 },
+  { 111, 1, 0x04, 0x00 },
+  { 112, 0, 0x02, 0x02 },
+  { 112, 0, 0x04, 0x04 },
+  { 112, 0, 0x04, 0x04 },
+  { 112, 1, 0x02, 0x00 },
+  { 113, 0, 0x04, 0x04 },
+  { 113, 0, 0x04, 0x04 },
+  { 113, 0, 0x01, 0x01 },
+  { 113, 0, 0x01, 0x01 },
+  { 113, 2, 0x02, 0x02 },
+  { 115, 1, 0x01, 0x00 },
+  { 116, 0, 0x02, 0x02 },
+  { 116, 0, 0x01, 0x01 },
+  { 116, 0, 0x02, 0x02 },
+  { 116, 1, 0x01, 0x00 },
+  { 117, 0, 0x02, 0x02 },
+  { 117, 0, 0x04, 0x04 },
+  { 117, 0, 0x02, 0x02 },
+  { 117, 0, 0x02, 0x02 },
+  { 117, 1, 0x02, 0x00 },
+  { 118, 0, 0x01, 0x01 },
+  { 118, 1, 0x01, 0x00 },
+  { 119, 0, 0x02, 0x02 },
+  { 119, 0, 0x01, 0x01 },
+};
+
+static const lexedge edges[119] = {
+  { 0x0061, 6 },
+  { 0x0063, 13 },
+  { 0x0064, 18 },
+  { 0x0065, 1 },
+  { 0x0066, 10 },
+  { 0x0068, 20 },
+  { 0x0069, 4 },
+  { 0x006a, 11 },
+  { 0x006c, 12 },
+  { 0x006d, 14 },
+  { 0x006e, 7 },
+  { 0x006f, 8 },
+  { 0x0070, 17 },
+  { 0x0072, 5 },
+  { 0x0073, 9 },
+  { 0x0074, 2 },
+  { 0x0076, 15 },
+  { 0x0079, 16 },
+  { 0x00e8, 3 },
+  { 0x00e9, 19 },
+  { 0x1d49, 21 },
+  { 0x0064, 26 },
+  { 0x006c, 24 },
+  { 0x006e, 25 },
+  { 0x0072, 28 },
+  { 0x0073, 23 },
+  { 0x0075, 22 },
+  { 0x0078, 27 },
+  { 0x0065, 29 },
+  { 0x006f, 32 },
+  { 0x0072, 30 },
+  { 0x0075, 31 },
+  { 0x00e9, 33 },
+  { 0x006d, 35 },
+  { 0x0072, 34 },
+  { 0x0063, 36 },
+  { 0x0065, 39 },
+  { 0x006c, 38 },
+  { 0x0076, 37 },
+  { 0x0069, 40 },
+  { 0x006c, 41 },
+  { 0x0075, 42 },
+  { 0x0065, 43 },
+  { 0x006f, 44 },
+  { 0x006e, 46 },
+  { 0x0072, 45 },
+  { 0x0065, 47 },
+  { 0x0065, 48 },
+  { 0x0069, 49 },
+  { 0x0065, 50 },
+  { 0x0061, 54 },
+  { 0x0065, 53 },
+  { 0x0075, 52 },
+  { 0x00e0, 51 },
+  { 0x0065, 56 },
+  { 0x0068, 57 },
+  { 0x0069, 55 },
+  { 0x0061, 59 },
+  { 0x006d, 60 },
+  { 0x006f, 58 },
+  { 0x0072, 61 },
+  { 0x006f, 62 },
+  { 0x0068, 63 },
+  { 0x0070, 64 },
+  { 0x0069, 65 },
+  { 0x0072, 66 },
+  { 0x0064, 67 },
+  { 0x0061, 68 },
+  { 0x0073, 69 },
+  { 0x0078, 70 },
+  { 0x0065, 71 },
+  { 0x0073, 72 },
+  { 0x006c, 73 },
+  { 0x0076, 74 },
+  { 0x006c, 75 },
+  { 0x0069, 76 },
+  { 0x0069, 77 },
+  { 0x006c, 78 },
+  { 0x0065, 79 },
+  { 0x0065, 80 },
+  { 0x0065, 81 },
+  { 0x0069, 82 },
+  { 0x0065, 83 },
+  { 0x0073, 84 },
+  { 0x006c, 85 },
+  { 0x0063, 86 },
+  { 0x0065, 87 },
+  { 0x006a, 88 },
+  { 0x0075, 89 },
+  { 0x0065, 90 },
+  { 0x0067, 91 },
+  { 0x0069, 92 },
+  { 0x0073, 94 },
+  { 0x0075, 93 },
+  { 0x0074, 95 },
+  { 0x0061, 96 },
+  { 0x0069, 97 },
+  { 0x006a, 98 },
+  { 0x0065, 99 },
+  { 0x0075, 100 },
+  { 0x0072, 101 },
+  { 0x0062, 102 },
+  { 0x0065, 103 },
+  { 0x0065, 104 },
+  { 0x0065, 105 },
+  { 0x0063, 106 },
+  { 0x0073, 107 },
+  { 0x0065, 108 },
+  { 0x0073, 109 },
+  { 0x0073, 110 },
+  { 0x0072, 111 },
+  { 0x0070, 112 },
+  { 0x0073, 113 },
+  { 0x0073, 114 },
+  { 0x0075, 115 },
+  { 0x0065, 116 },
+  { 0x0073, 117 },
+  { 0x0078, 118 },
+  { 0x0065, 119 },
+};
+
+const TLexicon lexicon_builtin = {
+  nodes,
+  edges,
+  120,
+  119,
+  NULL,
+  0,
+};
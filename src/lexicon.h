@@ -0,0 +1,99 @@
+#ifndef LEXICON_H
+#define LEXICON_H
+
+#include "parser.h"
+#include <stddef.h>
+#include <stdint.h>
+
+/* the lists of affixes (inclusive suffixes, inversions, abbreviations,
+ * ordinal suffixes) are compiled into a single trie, where characters
+ * are lowercase (see the lexicon directory, and tools/mklexicon.c).
+ * each node tells which lists have a word ending there (`term`), and
+ * which lists have a word going through it (`prefix`), so a string is
+ * matched in a single pass, whatever the size of the lists.
+ */
+
+/* lists */
+#define LEX_SUFFIX 0x01
+#define LEX_INVERSION 0x02
+#define LEX_ABBREV 0x04
+#define LEX_ORDINAL 0x08
+
+/* a node: its children are the edges [first, first + n), sorted by
+ * character. the root is the node 0. */
+typedef struct
+{
+  uint32_t first;
+  uint16_t n;
+  uint8_t prefix;
+  uint8_t term;
+} lexnode;
+
+typedef struct
+{
+  jchar c;
+  uint32_t node;
+} lexedge;
+
+typedef struct TLexicon
+{
+  const lexnode* nodes;
+  const lexedge* edges;
+  uint32_t n_nodes;
+  uint32_t n_edges;
+
+  /* the mapped file (see `load_lexicon`), or NULL */
+  void* _map;
+  size_t _size;
+} TLexicon;
+
+/* the lexicon compiled in the library (src/lexicon.c) */
+extern const TLexicon lexicon_builtin;
+
+/* a lexicon can also be compiled into a file (tools/mklexicon.c, with
+ * -o), that is mapped in memory as it is: a header, then the nodes and
+ * the edges, in the byte order of the machine. */
+#define LEX_MAGIC "jusqlex"
+#define LEX_VERSION 1
+#define LEX_BYTEORDER 0x01020304
+
+typedef struct
+{
+  char magic[8];      /* LEX_MAGIC */
+  uint32_t version;   /* LEX_VERSION */
+  uint32_t byteorder; /* LEX_BYTEORDER */
+  uint32_t n_nodes;
+  uint32_t n_edges;
+} lexheader;
+
+/* map a lexicon file. returns 0, or -1 if the file can't be read or
+ * is not a lexicon (of this version, and this byte order). the
+ * lexicon is read only, and can be used by several parsers at once. */
+int
+load_lexicon(TLexicon* lex, const char* path);
+
+/* unmap a lexicon loaded with `load_lexicon`. */
+void
+free_lexicon(TLexicon* lex);
+
+/* the child of `node` for the (lowercase) character `c`, or 0 (the
+ * root is never a child). */
+static inline uint32_t
+lex_child(const TLexicon* lex, uint32_t node, jchar c)
+{
+  const lexedge* e = &lex->edges[lex->nodes[node].first];
+  uint32_t lo = 0;
+  uint32_t hi = lex->nodes[node].n;
+
+  while (lo < hi) {
+    uint32_t mid = (lo + hi) / 2;
+    if (e[mid].c < c)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+
+  return (lo < lex->nodes[node].n && e[lo].c == c) ? e[lo].node : 0;
+}
+
+#endif
@@ -0,0 +1,180 @@
+#include "parallel.h"
+#include "stream.h"
+#include <pthread.h>
+#include <string.h>
+#include <unistd.h>
+
+typedef struct
+{
+  const TParser* model; /* the parser of the whole text */
+  int start;            /* the segment, in the text */
+  int end;
+  TTokens out;          /* the tokens, in the output, from `start` */
+  TNorms norms;         /* their normalized forms (if `norm`) */
+  int norm;
+  int n;                /* number of tokens */
+  int pos;              /* where the parser stopped */
+  int prev;             /* and its state (all the types, even filtered) */
+  int sent;
+} segment;
+
+static void*
+tokenize_segment(void* arg)
+{
+  segment* seg = arg;
+  TParser pst;
+
+  /* the segment starts after a space, so the state of the parser
+   * (`_prev`, `_next`) doesn't matter, but its settings do. */
+  init_parser(&pst, seg->model->str, seg->end);
+  pst.engine = seg->model->engine;
+  pst.opts = seg->model->opts;
+  pst.types = seg->model->types;
+  pst.hash = seg->model->hash;
+  pst.maxlen = seg->model->maxlen;
+  pst.lexicon = seg->model->lexicon;
+  pst.pos = seg->start;
+
+  /* the padding is after the last segment only */
+  pst.padded = seg->model->padded && seg->end == seg->model->strlen;
+
+  seg->n = get_tokens_norm(
+    &pst, &seg->out, seg->norm ? &seg->norms : NULL, seg->end - seg->start);
+  seg->pos = pst.pos;
+  seg->prev = pst._prev;
+  seg->sent = pst._sent;
+
+  return NULL;
+}
+
+int
+get_tokens_parallel(TParser* pst, TTokens* out, int capacity, int n_threads)
+{
+  return get_tokens_parallel_norm(pst, out, NULL, capacity, n_threads);
+}
+
+int
+get_tokens_parallel_norm(TParser* pst,
+  TTokens* out,
+  TNorms* norms,
+  int capacity,
+  int n_threads)
+{
+  jchar* str = pst->str;
+  int len = pst->strlen;
+  segment seg[PARALLEL_MAX_THREADS];
+  pthread_t threads[PARALLEL_MAX_THREADS];
+  int started[PARALLEL_MAX_THREADS];
+  int n_seg = 0;
+  int n = 0;
+  int start = 0;
+
+  if (n_threads <= 0)
+    n_threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+  if (n_threads > len / PARALLEL_MIN_SEGMENT)
+    n_threads = len / PARALLEL_MIN_SEGMENT;
+  if (n_threads > PARALLEL_MAX_THREADS)
+    n_threads = PARALLEL_MAX_THREADS;
+
+  if (n_threads <= 1 || capacity < len || pst->pos ||
+      (norms && norms->size - norms->used < 2 * len))
+    return get_tokens_norm(pst, out, norms, capacity);
+
+  /* cut the text at the last safe point before each share. */
+  for (int k = 1; k <= n_threads; k++) {
+    int share = (int)((long)len * k / n_threads);
+    int end = (k == n_threads) ? len : find_resync(str, start + 1, share);
+    if (end <= start)
+      continue;
+
+    seg[n_seg].model = pst;
+    seg[n_seg].start = start;
+    seg[n_seg].end = end;
+    seg[n_seg].out.start = out->start + start;
+    seg[n_seg].out.len = out->len + start;
+    seg[n_seg].out.type = out->type + start;
+    seg[n_seg].out.flags = out->flags + start;
+    seg[n_seg].out.hash = out->hash ? out->hash + start : NULL;
+    seg[n_seg].out.lhash = out->lhash ? out->lhash + start : NULL;
+    seg[n_seg].out.shape = out->shape ? out->shape + start : NULL;
+
+    /* each segment has its part of the arena: twice its length. */
+    seg[n_seg].norm = (norms != NULL);
+    if (norms) {
+      seg[n_seg].norms = *norms;
+      seg[n_seg].norms.buf = (jchar*)norms->buf + norms->used + 2 * start;
+      seg[n_seg].norms.size = 2 * (end - start);
+      seg[n_seg].norms.used = 0;
+      seg[n_seg].norms.start = norms->start + start;
+      seg[n_seg].norms.len = norms->len + start;
+    }
+    n_seg++;
+    start = end;
+  }
+
+  /* the first segment is done by this thread. if a thread can't be
+   * created, its segment is done here too. */
+  for (int k = 1; k < n_seg; k++)
+    started[k] =
+      !pthread_create(&threads[k], NULL, tokenize_segment, &seg[k]);
+  tokenize_segment(&seg[0]);
+  for (int k = 1; k < n_seg; k++) {
+    if (started[k])
+      pthread_join(threads[k], NULL);
+    else
+      tokenize_segment(&seg[k]);
+  }
+
+  /* move the tokens together */
+  for (int k = 0; k < n_seg; k++) {
+    size_t size = (size_t)seg[k].n;
+
+    if (k) {
+      memmove(out->start + n, seg[k].out.start, sizeof(uint32_t) * size);
+      memmove(out->len + n, seg[k].out.len, sizeof(uint32_t) * size);
+      memmove(out->type + n, seg[k].out.type, size);
+      memmove(out->flags + n, seg[k].out.flags, size);
+      if (out->hash)
+        memmove(out->hash + n, seg[k].out.hash, sizeof(uint64_t) * size);
+      if (out->lhash)
+        memmove(out->lhash + n, seg[k].out.lhash, sizeof(uint64_t) * size);
+      if (out->shape)
+        memmove(out->shape + n, seg[k].out.shape, size);
+
+      /* the first token of the segment (not a space: the segment
+       * starts after a space) follows the last token of the previous
+       * one, filtered out or not: its flags are set from the state of
+       * the parser of the previous segment. the next tokens don't
+       * depend on it. */
+      if (size && out->start[n] == (uint32_t)seg[k].start) {
+        out->flags[n] = (seg[k - 1].prev == TS_SPACE) ? TF_SPACEBEFORE : 0;
+        if (seg[k - 1].sent && !ENDS_SENTENCE(out->type[n]))
+          out->flags[n] |= TF_SENTSTART;
+      }
+    }
+
+    /* and the normalized forms too */
+    if (norms) {
+      jchar* dst = (jchar*)norms->buf + norms->used;
+      size_t used = (size_t)seg[k].norms.used;
+
+      memmove(norms->start + n, seg[k].norms.start, sizeof(uint32_t) * size);
+      memmove(norms->len + n, seg[k].norms.len, sizeof(uint32_t) * size);
+      memmove(dst, seg[k].norms.buf, sizeof(jchar) * used);
+      for (int i = n; i < n + seg[k].n; i++)
+        norms->start[i] += (uint32_t)norms->used;
+      norms->used += seg[k].norms.used;
+    }
+
+    n += seg[k].n;
+    pst->pos = seg[k].pos;
+    pst->_prev = seg[k].prev;
+    pst->_sent = seg[k].sent;
+
+    /* the text ends in the segment ('\0') */
+    if (seg[k].pos < seg[k].end)
+      break;
+  }
+
+  return n;
+}
@@ -0,0 +1,35 @@
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include "parser.h"
+
+/* a text can be tokenized by several threads: it's split into
+ * segments, at safe points (see `find_resync` in stream.h), and the
+ * tokens of the segments are put back in order. the tokens are the
+ * same as with `get_tokens` on the whole text.
+ */
+
+// texts are not split into segments shorter than this
+#define PARALLEL_MIN_SEGMENT 65536
+#define PARALLEL_MAX_THREADS 64
+
+// tokenize the whole text of a parser (initialized by `init_parser`,
+// with its settings: engine, maximum length, lexicon). `capacity`
+// must be at least the length of the text (there are never more
+// tokens than characters), else the text is tokenized by a single
+// thread, up to `capacity` tokens. if `n_threads` is 0, there is one
+// thread per processor. returns the number of tokens.
+int get_tokens_parallel(TParser* pst,
+  TTokens* out,
+  int capacity,
+  int n_threads);
+
+// the same, with the normalized forms (see `get_tokens_norm`): the
+// arena must be twice as long as the text (else, a single thread).
+int get_tokens_parallel_norm(TParser* pst,
+  TTokens* out,
+  TNorms* norms,
+  int capacity,
+  int n_threads);
+
+#endif
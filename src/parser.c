@@ -1,32 +1,41 @@
 /* jusquci -- french tokenizer. */
 
 #include "affixes.h"
+#include "encoding.h"
+#include "hash.h"
+#include "lexicon.h"
 #include "parser.h"
-#include "punct.h"
+#include "probes.h"
 #include "util.h"
 #include <stdlib.h>
-#include <wchar.h>
-#include <wctype.h>
 
 /* these functions modify TParser values (especially `pos`) and
  * returns the token type (word, url, digit, ordinal, ...).
  */
 int
-parse_word(TParser* pst);
-int
-parse_url(TParser* pst, jchar c);
+JFN(parse_url)(TParser* pst, jchar c);
 void
-parse_citekey(TParser* pst);
+JFN(parse_citekey)(TParser* pst);
 int
-parse_digit(TParser* pst);
+JFN(parse_digit)(TParser* pst);
 
 /* initialize values for a parser. */
+#ifdef JUSQUCI_UTF8
+void
+init_parser_utf8(TParser* pst, char* str, int len)
+{
+  /* string's informations */
+  pst->str = NULL;
+  pst->_str = str;
+  pst->strlen = len;
+#else
 void
 init_parser(TParser* pst, jchar* str, int len)
 {
   /* string's informations */
   pst->str = str;
   pst->strlen = len;
+#endif
 
   /* start at the beginning of the string. */
   pst->pos = 0;
@@ -39,115 +48,37 @@ init_parser(TParser* pst, jchar* str, int len)
   /* special cases when next token's type is already known. */
   pst->_next = TS_START;
   pst->_prev = TS_START;
-}
-
-int
-parse_word(TParser* pst)
-{
-  jchar c = pst->str[pst->pos];
-  int par = 0;
-  int len;
 
-  while (pst->pos < pst->strlen) {
-
-    c = pst->str[pst->pos];
-
-    switch (c) {
-
-      /* opening parentheses */
-      case '(':
-      case '[':
-      case '{':
-        par = 1;
-        break;
-
-      /* closing parentheses */
-      case ')':
-      case ']':
-      case '}':
-        if (!par)
-          return TS_WORD;
-        par = 0;
-        break;
-
-      case '-':
-        /* depuis->là */
-        if (!iswalpha(pst->str[pst->pos + 1])) {
-          return TS_WORD;
-        }
-        /* penses-tu */
-        else if (is_inversion(pst)) {
-          pst->_next = TS_WORD;
-          return TS_WORD;
-        }
-        break;
-
-      /* dots */
-      case '.':
-        /* auteur.rice */
-        if ((len = is_incl_suff(pst, c))) {
-          pst->pos += len - 1;
-          break;
-        }
-        /* p. ex. */
-        else if ((is_abbrev(pst))) {
-          pst->pos++;
-          return TS_ABBREV;
-        }
-        /* Adieu. */
-        else {
-          return TS_WORD;
-        }
-        break;
-
-      /* very minimal support for "·ère": it's not check, just */
-      /* assumed that it is inclusive language. */
-      case L'·':
-        if (pst->strlen - pst->pos &&
-            iswalpha(pst->str[pst->pos + 1])) {
-          pst->pos++;
-        } else {
-          return TS_WORD;
-        }
-        break;
-
-      /* n° 47 */
-      case L'°':
-        pst->pos++;
-        return TS_ABBREV;
-
-      /* jusqu' ici */
-      case '\'':
-      case L'’':
-      case L'‘':
-        pst->pos++;
-        return TS_WORD;
-        break;
-
-      default:
-        if (!iswordch(c))
-          return TS_WORD;
-        break;
-    }
-
-    pst->pos++;
-  }
-
-  return TS_WORD;
+  /* the text starts a sentence. */
+  pst->_sent = 1;
+
+  pst->engine = ENGINE_SWITCH;
+  pst->opts = OPT_ALL;
+  pst->types = TYPES_ALL;
+  pst->hash = HASH_MURMUR;
+  pst->maxlen = 0;
+  pst->padded = 0;
+  pst->lexicon = &lexicon_builtin;
+
+#ifdef JUSQUCI_UTF8
+  PROBE_INIT(len, 1);
+#else
+  PROBE_INIT(len, 0);
+#endif
 }
 
 void
-parse_citekey(TParser* pst)
+JFN(parse_citekey)(TParser* pst)
 {
   int chtype;
   jchar c;
 
-  /* @becker1982, @_12xZle */
+  /* @becker1982, @_12xZle (the combining marks are letters here) */
   while (pst->pos < pst->strlen) {
-    c = pst->str[pst->pos];
+    c = JCH(pst, pst->pos);
     chtype = getchtype(c);
-    if (chtype == Ch_Word || chtype == Ch_Digit || c == '_')
-      pst->pos++;
+    if (chtype == Ch_Word || chtype == Ch_Digit || c == '_' || jiswalpha(c))
+      pst->pos = JNEXT(pst, pst->pos);
     else
       break;
   }
@@ -156,44 +87,37 @@ parse_citekey(TParser* pst)
 /* enseignant.e */
 /* www.on-tenk.com */
 int
-parse_url(TParser* pst, jchar c)
+JFN(parse_url)(TParser* pst, jchar c)
 {
-  jchar* x = &pst->str[pst->pos];
+  const jchar* prefix = (c == L'h') ? U"http" : U"www.";
 
   if (pst->strlen - pst->pos < 4)
     return 0;
 
-  if (cmpi((c == L'h') ? U"http" : U"www.", x, 4)) {
+  if (cmpi(pst, pst->pos, pst->strlen, prefix) == 4) {
+    /* the character at the end is not read */
     do {
-      pst->pos++;
-      c = pst->str[pst->pos];
-    } while (
-      pst->pos < pst->strlen && (!iswspace(c) && !iswcntrl(c)));
+      pst->pos = JNEXT(pst, pst->pos);
+      pst->pos = JSKIP(pst, pst->pos, Scan_Url);
+    } while (pst->pos < pst->strlen &&
+             (c = JCH(pst, pst->pos), !jiswspace(c) && !jiswcntrl(c)));
     return 1;
   }
 
   return 0;
 }
 
-#define N_SUFF_ORD 5
-const jchar* const suff_ord[] = {
-  U"ère",
-  U"ème",
-  U"er",
-  U"e",
-  U"ᵉ",
-};
-
 int
-parse_digit(TParser* pst)
+JFN(parse_digit)(TParser* pst)
 {
   jchar c;
   int tryord = 1; /* start at 1, cause number starts with digit */
-  size_t lenord = 0;
+  int lenord = 0;
 
+  /* digits and signs are ascii: one code unit each. */
   int i = pst->pos + 1;
   for (; i < pst->strlen; i++) {
-    c = pst->str[i];
+    c = JCH(pst, i);
     switch (c) {
       case '0':
       case '1':
@@ -232,11 +156,11 @@ EndDigit:
   if (!tryord)
     return TS_NUMBER;
 
-  lenord = cmpiany(
-    &pst->str[pst->pos], suff_ord, (size_t)(pst->strlen-i), N_SUFF_ORD);
+  lenord =
+    STAT_HIT(Stat_MatchOrdinal, JFN(match_ordinal)(pst, pst->pos));
   if (lenord) {
-    pst->pos += (int)lenord;
-    if (pst->str[pst->pos] == L's')
+    pst->pos += lenord;
+    if (pst->pos < pst->strlen && JCH(pst, pst->pos) == L's')
       pst->pos++;
     return TS_ORDINAL;
   }
@@ -244,248 +168,368 @@ EndDigit:
   return TS_NUMBER;
 }
 
+/* the variants of the tokenizer (token.c) */
+int
+JFN(parse_token_all)(TParser* pst);
 int
-get_token(TParser* pst)
+JFN(parse_token_plain)(TParser* pst);
+int
+JFN(parse_token_opts)(TParser* pst);
+int
+JFN(parse_token_pad)(TParser* pst);
+
+/* the variant for the options of the parser: the common profiles are
+ * specialized at compile time (and OPT_ALL for a padded string, if
+ * the padding is at `strlen`). */
+static inline int
+JFN(parse_token)(TParser* pst, int padded)
 {
-  jchar c;
-  int chtype; /* character type */
-  int ttype;  /* token type */
-  int tlen;
-
-  /* reach the end */
-  if (pst->pos >= pst->strlen) {
-    pst->pos = pst->strlen;
-    pst->tidx = pst->strlen;
-    pst->tlen = 0;
-    return TS_END;
+  switch (pst->opts) {
+    case OPT_ALL:
+      if (padded)
+        return JFN(parse_token_pad)(pst);
+      return JFN(parse_token_all)(pst);
+    case OPT_NONE:
+      return JFN(parse_token_plain)(pst);
+    default:
+      return JFN(parse_token_opts)(pst);
   }
+}
 
-  c = pst->str[pst->pos]; /* current character */
-  pst->tidx = pst->pos;   /* the token start index */
-
-  switch (c) {
+/* get the next token. with a maximum length, the end of the string is
+ * moved (for this token only), so that no recognizer reads further:
+ * each token costs at most `maxlen` characters. */
+int
+JFN(get_token)(TParser* pst)
+{
+  int strlen = pst->strlen;
+  int ttype;
 
-    /* end of string. it should not get to this point. */
-    case L'\0':
-      ttype = TS_END;
-      chtype = Ch_Ctrl;
-      goto EndToken;
-      break;
+  if (pst->maxlen <= 0)
+    return JFN(parse_token)(pst, pst->padded);
 
-    /* simple white space */
-    case L' ':
-      chtype = Ch_Space;
-      if (pst->_prev == TS_SPACE) {
-        ttype = TS_SPACESIGN;
-      } else {
-        ttype = TS_SPACE;
-        pst->pos++;
-        goto EndToken;
-      }
-      break;
+  /* the padding is not after the moved end */
+  pst->strlen = token_end(pst);
+  ttype = JFN(parse_token)(pst, 0);
+  pst->strlen = strlen;
 
-    /* newline */
-    case L'\n':
-      ttype = TS_NEWLINE;
-      chtype = Ch_Space;
-      pst->pos++;
-      goto EndToken;
-      break;
+  return ttype;
+}
 
-    /* periodcentered is a punct sign unless it's inside a word */
-    case L'·':
-      ttype = TS_PUNCT;
-      chtype = Ch_Punct;
-      pst->pos++;
-      goto EndToken;
-      break;
+/* the utf-8 bytes of the character `c`, read at index `i` (an invalid
+ * byte is kept as it is). returns their number. */
+static inline int
+JFN(char_bytes)(const TParser* pst, int i, jchar c, unsigned char* u)
+{
+#ifdef JUSQUCI_UTF8
+  if (c == 0xfffd && utf8_width(pst, i) == 1) {
+    u[0] = JSTR(pst)[i];
+    return 1;
+  }
+#else
+  (void)pst;
+  (void)i;
+#endif
+  return utf8_encode(c, u);
+}
 
-    case L':':
-      chtype = Ch_PunctEndSent;
-      /* :happy: */
-      if ((tlen = is_emoji(pst))) {
-        ttype = TS_EMOJI;
-        pst->pos += tlen;
-        /* :-) */
-      } else if ((tlen = is_side_emoticon(pst, 1))) {
-        ttype = TS_EMOTICON;
-        pst->pos += tlen;
-        /* default usage */
-      } else {
-        ttype = TS_PUNCTSTRONG;
-        pst->pos++;
-      }
-      goto EndToken;
-      break;
+/* write the normalized form (NORM_*) of the current token at the end
+ * of the arena. returns 0 if it doesn't fit. */
+static int
+JFN(write_norm)(const TParser* pst, TNorms* norms, int n)
+{
+  int end = pst->tidx + pst->tlen;
+  int k = norms->used;
+  unsigned int fold;
+  jchar c;
 
-    case L';':
-      /* :-) */
-      chtype = Ch_PunctEndSent;
-      if ((tlen = is_side_emoticon(pst, 1))) {
-        ttype = TS_EMOTICON;
-        pst->pos += tlen;
-        /* default usage */
-      } else {
-        ttype = TS_PUNCTSTRONG;
-        pst->pos++;
-      }
-      goto EndToken;
-      break;
+  for (int i = pst->tidx; i < end; i = JNEXT(pst, i)) {
+    c = JCH(pst, i);
+    if (norms->opts & NORM_LOWER)
+      c = jtowlower(c);
+    fold = (norms->opts & NORM_UNACCENT) ? jch_fold(c) : 0;
+
+    /* the diacritics of a decomposed text (nfd) */
+    if ((norms->opts & NORM_UNACCENT) && jiswdiacritic(c))
+      continue;
+
+#ifdef JUSQUCI_UTF8
+    unsigned char* s = norms->buf;
+    unsigned char u[4];
+    int w;
+
+    if (fold) {
+      u[0] = (unsigned char)(fold & 0xff);
+      u[1] = (unsigned char)(fold >> 8);
+      w = u[1] ? 2 : 1;
+    } else
+      w = JFN(char_bytes)(pst, i, c, u);
+
+    if (norms->size - k < w)
+      return 0;
+    for (int j = 0; j < w; j++)
+      s[k++] = u[j];
+#else
+    jchar* s = norms->buf;
+
+    if (norms->size - k < ((fold >> 8) ? 2 : 1))
+      return 0;
+    if (fold) {
+      s[k++] = fold & 0xff;
+      if (fold >> 8)
+        s[k++] = fold >> 8;
+    } else
+      s[k++] = c;
+#endif
+  }
 
-    case L'=':
-      chtype = Ch_Punct;
-      ttype = TS_PUNCT;
-      /* =) */
-      if ((tlen = is_side_emoticon(pst, 1))) {
-        ttype = TS_EMOTICON;
-        pst->pos += tlen;
-        /* ===> */
-      } else if ((tlen = is_arrow(pst))) {
-        pst->pos += tlen;
-        goto EndToken;
-        /* ici = là */
-      } else {
-        pst->pos++;
-        goto EndToken;
-      }
-      break;
+  norms->start[n] = (uint32_t)norms->used;
+  norms->len[n] = (uint32_t)(k - norms->used);
+  norms->used = k;
 
-    case L'^':
-      chtype = Ch_Punct;
-      /* ^^ */
-      if ((tlen = is_emoticon_super(pst))) {
-        ttype = TS_EMOTICON;
-        pst->pos += tlen;
-        /* as an simili-punctuation sign */
-      } else {
-        ttype = TS_PUNCT;
-        pst->pos++;
-      }
-      goto EndToken;
-      break;
+  return 1;
+}
 
-    case L'x':
-    case L'X':
-      /* XD, x.x */
-      if ((tlen = is_face_emoticon(pst)) ||
-          ((tlen = is_side_emoticon(pst, 1)))) {
-        ttype = TS_EMOTICON;
-        chtype = Ch_Punct;
-        pst->pos += tlen;
-        goto EndToken;
-      } else {
-        chtype = Ch_Word;
-        ttype = TS_WORD;
-      }
-      break;
+/* the hash (HASH_*) of the current token, as it is or lowercase: of
+ * `len` bytes, given one at a time. */
+static uint64_t
+JFN(hash_token)(const TParser* pst, int lower, size_t len)
+{
+  int end = pst->tidx + pst->tlen;
+  unsigned char u[4];
+  THash h;
+  jchar c;
+  int w;
+
+  hash_init(&h, pst->hash, len);
+  for (int i = pst->tidx; i < end; i = JNEXT(pst, i)) {
+    c = JCH(pst, i);
+    w = JFN(char_bytes)(pst, i, lower ? jtowlower(c) : c, u);
+    for (int j = 0; j < w; j++)
+      hash_byte(&h, u[j]);
+  }
 
-    case L'v':
-    case L'o':
-    case L'ô':
-    case L'V':
-    case L'O':
-    case L'Ô':
-      /* v.v ô.ô O_o */
-      if ((tlen = is_face_emoticon(pst))) {
-        ttype = TS_EMOTICON;
-        chtype = Ch_Punct;
-        pst->pos += tlen;
-        goto EndToken;
-      } else {
-        chtype = Ch_Word;
-        ttype = TS_WORD;
-      }
-      break;
+  return hash_final(&h);
+}
 
-    case L'(':
-    case L'[':
-      /* (: */
-      if ((tlen = is_side_emoticon(pst, 0))) {
-        ttype = TS_EMOTICON;
-        pst->pos += tlen;
-        goto EndToken;
-      }
-      chtype = is_intrapar_start(pst, c) ? Ch_Word : Ch_Punct;
-      break;
+/* the hashes of a token longer than the buffers: murmurhash starts
+ * with the length, so the lengths (in utf-8) are read first. */
+static void
+JFN(write_long_hashes)(const TParser* pst, TTokens* out, int n)
+{
+  int end = pst->tidx + pst->tlen;
+  size_t len = 0, llen = 0;
+  unsigned char u[4];
+  jchar c;
 
-    case L'h':
-    case L'w':
-      /* www.on-tenk.com */
-      if (parse_url(pst, c)) {
-        chtype = Ch_Word;
-        ttype = TS_URL;
-        goto EndToken;
-      }
-      ttype = TS_WORD;
-      chtype = Ch_Word;
-      break;
+  for (int i = pst->tidx; i < end; i = JNEXT(pst, i)) {
+    c = JCH(pst, i);
+    len += (size_t)JFN(char_bytes)(pst, i, c, u);
+    llen += (size_t)JFN(char_bytes)(pst, i, jtowlower(c), u);
+  }
 
-    case L'-':
-      chtype = Ch_Punct;
-      ttype = Ch_Punct;
-      /* -je */
-      if (pst->_next == TS_WORD) {
-        pst->_next = TS_START;
-        pst->pos++;
-        chtype = Ch_Word;
-        ttype = TS_WORD;
-        /* ---> */
-      } else if ((tlen = is_arrow(pst))) {
-        pst->pos += tlen;
-        goto EndToken;
-      } else {
-        pst->pos++;
-        goto EndToken;
-      }
-      break;
+  if (out->hash)
+    out->hash[n] = JFN(hash_token)(pst, 0, len);
+  if (out->lhash)
+    out->lhash[n] = JFN(hash_token)(pst, 1, llen);
+}
 
-    default:
-      chtype = getchtype(c);
-      break;
+/* write the hashes of the current token, in the columns of `out` that
+ * are set. the token is written in utf-8, as it is and lowercase, then
+ * hashed by blocks (once, if it's already lowercase). */
+static void
+JFN(write_hashes)(const TParser* pst, TTokens* out, int n)
+{
+  int end = pst->tidx + pst->tlen;
+  unsigned char s[HASH_BUF_SIZE + 4], ls[HASH_BUF_SIZE + 4];
+  size_t len = 0, llen = 0;
+  int lower = 1;
+  jchar c, l;
+
+  for (int i = pst->tidx; i < end; i = JNEXT(pst, i)) {
+    if (len > HASH_BUF_SIZE || llen > HASH_BUF_SIZE) {
+      JFN(write_long_hashes)(pst, out, n);
+      return;
+    }
+    c = JCH(pst, i);
+    l = jtowlower(c);
+    if (l != c)
+      lower = 0;
+    if (c < 0x80) {
+      s[len++] = (unsigned char)c;
+      ls[llen++] = (unsigned char)l;
+    } else {
+      len += (size_t)JFN(char_bytes)(pst, i, c, &s[len]);
+      llen += (size_t)JFN(char_bytes)(pst, i, l, &ls[llen]);
+    }
   }
 
-  switch (chtype) {
+  if (out->hash)
+    out->hash[n] = hash_bytes(pst->hash, s, len);
+  if (out->lhash)
+    out->lhash[n] = (lower && out->hash) ? out->hash[n]
+                                         : hash_bytes(pst->hash, ls, llen);
+}
 
-    case Ch_Word:
-      ttype = parse_word(pst);
-      break;
+/* the shape of the current token (SH_*). a numeral is as `like_num` of
+ * spacy (french): a sign, then digits (with ',' and '.'), or a
+ * fraction. a '.' or a '·' followed by a letter, in a word, is an
+ * inclusive suffix (the other ones end the word). the letters (most
+ * of the characters) only go through bitwise operations. */
+static int
+JFN(token_shape)(const TParser* pst, int ttype)
+{
+  int end = pst->tidx + pst->tlen;
+  unsigned int seen = 0, ctype;
+  int upper, lower, untitled = 0, cased = 0;
+  int digits = 0, denom = 0, slashes = 0, other = 0;
+  int dot = 0, incl = 0;
+  int shape = 0;
+  jchar c;
 
-    case Ch_Digit:
-      ttype = parse_digit(pst);
-      break;
+  for (int i = pst->tidx; i < end; i = JNEXT(pst, i)) {
+    c = JCH(pst, i);
+    ctype = jch_ctype(c);
+    seen |= ctype;
 
-    case Ch_Ctrl:
-    case Ch_Space:
-    case Ch_PunctEndSent:
-      ttype = chtype;
-      while (pst->pos < pst->strlen &&
-             getchtype(pst->str[pst->pos]) == chtype)
-        pst->pos++;
-      break;
+    /* a combining mark (nfd): a diacritic of the letter before */
+    if (ctype & JCH_MARK) {
+      shape |= SH_ACCENT;
+      continue;
+    }
 
-    case Ch_CiteKeyChar:
-      ttype = TS_CITEKEY;
-      pst->pos++;
-      parse_citekey(pst);
+    /* as python's istitle: an uppercase letter after a cased one, or a
+     * lowercase letter after an uncased character (a titlecase letter
+     * is both: it's uppercase) */
+    upper = (ctype & JCH_UPPER) != 0;
+    lower = (ctype & (JCH_UPPER | JCH_LOWER)) == JCH_LOWER;
+    untitled |= (upper & cased) | (lower & !cased);
+    cased = upper | lower;
+
+    if (ctype & JCH_ALPHA) {
+      other = 1;
+      incl |= dot;
+      dot = 0;
+      if (c >= 0x80 && jch_fold(c))
+        shape |= SH_ACCENT;
+      continue;
+    }
+
+    dot = 0;
+    switch (c) {
+      case '.':
+        dot = 1;
+        break;
+      case L'·':
+        dot = 1;
+        other = 1;
+        break;
+      case ',':
+        break;
+      case '/':
+        slashes++;
+        break;
+      case '+':
+      case '-':
+      case L'±':
+      case '~':
+        if (i != pst->tidx)
+          other = 1;
+        break;
+      case '\'':
+      case L'’':
+      case L'‘':
+        shape |= SH_APOSTROPHE;
+        other = 1;
+        break;
+      default:
+        if (!(ctype & JCH_DIGIT))
+          other = 1;
+        else if (slashes)
+          denom++;
+        else
+          digits++;
+    }
+  }
+
+  if ((seen & JCH_UPPER) && !(seen & JCH_LOWER))
+    shape |= SH_UPPER;
+  if ((seen & JCH_LOWER) && !(seen & JCH_UPPER))
+    shape |= SH_LOWER;
+  if (!untitled && (seen & (JCH_UPPER | JCH_LOWER)))
+    shape |= SH_TITLE;
+  if (seen & JCH_DIGIT)
+    shape |= SH_DIGIT;
+  if (!other && digits && (slashes ? slashes == 1 && denom : 1))
+    shape |= SH_LIKENUM;
+  if (incl && ttype == TS_WORD)
+    shape |= SH_INCLUSIVE;
+
+  return shape;
+}
+
+static int
+JFN(fill_tokens)(TParser* pst, TTokens* out, TNorms* norms, int capacity)
+{
+  int ttype;
+  int prev, next, pos;
+  int n = 0;
+
+  while (n < capacity) {
+    prev = pst->_prev;
+    next = pst->_next;
+    pos = pst->pos;
+    ttype = (pst->engine == ENGINE_DFA) ? JFN(get_token_dfa)(pst)
+                                        : JFN(get_token)(pst);
+    if (ttype == TS_END)
       break;
 
-    case Ch_Punct:
-    default:
-      pst->pos++;
-      ttype = TS_PUNCT;
+    /* a type that is filtered out: only the state is kept (`_prev`
+     * is set by the parser) */
+    if (!(pst->types & TYPE_BIT(ttype))) {
+      if (ttype != TS_SPACE)
+        pst->_sent = ENDS_SENTENCE(ttype);
+      continue;
+    }
+
+    /* the arena is full: the token will be parsed again. */
+    if (norms && !JFN(write_norm)(pst, norms, n)) {
+      pst->pos = pos;
+      pst->_prev = prev;
+      pst->_next = next;
       break;
-  }
+    }
 
-EndToken:
+    out->start[n] = (uint32_t)pst->tidx;
+    out->len[n] = (uint32_t)pst->tlen;
+    out->type[n] = (uint8_t)ttype;
+    out->flags[n] = (prev == TS_SPACE) ? TF_SPACEBEFORE : 0;
+    if (ttype != TS_SPACE) {
+      if (pst->_sent && !ENDS_SENTENCE(ttype))
+        out->flags[n] |= TF_SENTSTART;
+      pst->_sent = ENDS_SENTENCE(ttype);
+    }
+    if (out->hash || out->lhash)
+      JFN(write_hashes)(pst, out, n);
+    if (out->shape)
+      out->shape[n] = (uint8_t)JFN(token_shape)(pst, ttype);
+    n++;
+  }
 
-  /* end of string */
-  if (pst->pos > pst->strlen)
-    pst->pos = pst->strlen;
+  return n;
+}
 
-  /* update the token informations */
-  pst->tlen = pst->pos - pst->tidx;
-  pst->ttype = ttype;
-  pst->_prev = ttype;
+int
+JFN(get_tokens)(TParser* pst, TTokens* out, int capacity)
+{
+  return JFN(fill_tokens)(pst, out, NULL, capacity);
+}
 
-  return ttype;
+int
+JFN(get_tokens_norm)(TParser* pst,
+  TTokens* out,
+  TNorms* norms,
+  int capacity)
+{
+  return JFN(fill_tokens)(pst, out, norms, capacity);
 }
@@ -1,8 +1,12 @@
 #ifndef PARSER_H
 #define PARSER_H
 
+#include <stdint.h>
+
 typedef unsigned int jchar; // jchar == pg_wchar == Py_UCS4
 
+struct TLexicon; // lexicon.h
+
 // the parser struct holds informations about string to be parsed,
 // state (position) and current token.
 typedef struct
@@ -18,7 +22,8 @@ typedef struct
   int ttype; // token type (word, space, ...)
 
   // for char*.
-  // (not used by 'get_token', only for the Postgres extension)
+  // (not used by 'get_token': used by 'get_token_utf8', and by the
+  // Postgres extension)
   char* _str;
   int _mb; // multibytes characters (difference)
   int _pos;
@@ -29,12 +34,170 @@ typedef struct
   int _next;
   int _prev;
 
+  // the last token (but spaces) ends a sentence (see TF_SENTSTART).
+  int _sent;
+
+  // the engine used by 'get_tokens' (ENGINE_*).
+  int engine;
+
+  // the options of the tokenizer (OPT_*): OPT_ALL by default.
+  int opts;
+
+  // the token types returned by 'get_tokens' (TYPE_BIT): TYPES_ALL by
+  // default.
+  unsigned int types;
+
+  // the hash function of the tokens (HASH_*), when the TTokens have
+  // a column for them: HASH_MURMUR by default.
+  int hash;
+
+  // the maximum length of a token (in code units), 0 for none. the
+  // parser never reads further than `maxlen` from the start of a
+  // token: a longer token is cut.
+  int maxlen;
+
+  // the string is followed by JUSQUCI_PAD code units '\0', allocated
+  // by the caller: the loops of the tokenizer stop on them, without
+  // comparing the positions with `strlen` (see token_pad.c). 0 by
+  // default.
+  int padded;
+
+  // the lists of affixes and abbreviations (lexicon.h): the lexicon
+  // compiled in the library, or a lexicon file.
+  const struct TLexicon* lexicon;
+
 } TParser;
 
+// a buffer of tokens, stored as columns (one array per field).
+// the arrays are allocated by the caller, with the same capacity.
+typedef struct
+{
+  uint32_t* start; // index of the first character
+  uint32_t* len;   // length
+  uint8_t* type;   // token type (word, space, ...)
+  uint8_t* flags;  // TF_* flags
+
+  // optional columns (NULL: not computed): the 64-bit hash of each
+  // token (see `pst->hash`), and of its lowercase form.
+  uint64_t* hash;
+  uint64_t* lhash;
+
+  // optional too: the shape of each token (SH_* flags)
+  uint8_t* shape;
+} TTokens;
+
+// token flags
+#define TF_SPACEBEFORE 0x01 // the previous token is a simple space
+#define TF_SENTSTART 0x02   // the token starts a sentence
+
+// the tokens after which a sentence starts: the next token that is
+// not a space (and that doesn't end a sentence itself) starts it.
+#define ENDS_SENTENCE(ttype)                                                \
+  ((ttype) == TS_PUNCTSTRONG || (ttype) == TS_NEWLINE ||                    \
+   (ttype) == TS_EMOTICON || (ttype) == TS_EMOJI || (ttype) == TS_URL)
+
+// the shape of a token: properties of its characters, read once it's
+// parsed (as the lexical attributes of spacy, that read each token
+// again otherwise).
+#define SH_UPPER 0x01      // its cased letters are uppercase (is_upper)
+#define SH_LOWER 0x02      // its cased letters are lowercase (is_lower)
+#define SH_TITLE 0x04      // titlecased (is_title): Paris, Jean-Luc
+#define SH_LIKENUM 0x08    // a numeral (like_num): 12, -3,5, 1.000, 3/4
+#define SH_DIGIT 0x10      // it has a digit
+#define SH_ACCENT 0x20     // a letter with diacritics (é, œ: see jch_fold)
+#define SH_APOSTROPHE 0x40 // an apostrophe: ' ’ ‘
+#define SH_INCLUSIVE 0x80  // an inclusive suffix: auteur·rice, ami.e.s
+
+// normalized forms (see get_tokens_norm)
+#define NORM_LOWER 0x01    // lowercase
+#define NORM_UNACCENT 0x02 // without diacritics (é -> e, œ -> oe)
+
+// the normalized forms of the tokens, written by the parser in an
+// arena allocated by the caller: characters (jchar), or bytes for
+// utf-8 strings. the normalized form of the n-th token is at
+// `start[n]` in the arena, and the token itself (in the original
+// string) at `start[n]` in the TTokens. the arrays `start` and `len`
+// have the same capacity as the TTokens.
+typedef struct
+{
+  int opts;        // NORM_* options
+  void* buf;       // the arena
+  int size;        // its size (in code units)
+  int used;        // its used part (set it to 0 to reuse the arena)
+  uint32_t* start; // index of the normalized form, in the arena
+  uint32_t* len;   // its length
+} TNorms;
+
+// options of the tokenizer: the tokens that are recognized. without
+// an option, its characters are parsed as punctuation signs (or as
+// words). the common profiles (OPT_ALL, OPT_NONE) have their own
+// variant of the tokenizer, specialized at compile time (token.c):
+// the other ones are a bit slower. the state machine (ENGINE_DFA) is
+// only used with OPT_ALL.
+#define OPT_EMOTICONS 0x01 // :-) ^^ x.x
+#define OPT_EMOJIS 0x02    // :happy:
+#define OPT_CITEKEYS 0x04  // @becker1982
+#define OPT_INCLUSIVE 0x08 // auteur.rice.s, auteur·rice
+#define OPT_NONE 0x00
+#define OPT_ALL 0x0f
+
+// the padding of a padded string (`pst->padded`): '\0' code units
+// (characters, or bytes for utf-8 strings) after `strlen`. the
+// widest block of the scans (scan.h) is read at once.
+#define JUSQUCI_PAD 32
+
+// hash functions of the tokens (hash.h): on their utf-8 bytes.
+#define HASH_MURMUR 0 // murmurhash64a, seed 1 (the hashes of spacy)
+#define HASH_FNV 1    // fnv-1a, 64 bits
+
+// the filter of the token types: the types that are not in
+// `pst->types` are skipped by 'get_tokens' (and 'get_tokens_norm':
+// no normalized form is written), but the state of the parser is kept
+// (the flags of the next tokens are the same). 'get_token' returns
+// every token.
+#define TYPE_BIT(ttype) (1u << (ttype))
+#define TYPES_ALL 0xffffu
+
+// engines
+#define ENGINE_SWITCH 0 // the hand-written parser (get_token)
+#define ENGINE_DFA 1    // the generated state machine (get_token_dfa)
+
 // main functions
 int get_token(TParser* pst);
 void init_parser(TParser* pst, jchar* str, int len);
 
+// the same as 'get_token', with the generated state machine (dfa.h).
+// the tokens are the same.
+int get_token_dfa(TParser* pst);
+
+// parse up to `capacity` tokens at once (of the types of
+// `pst->types`). returns the number of tokens written in `out`: 0
+// when the end of the string is reached. it can be called again when
+// the buffer is full. the hashes and the shapes of the tokens are
+// written too, in the columns of `out` that are set.
+int get_tokens(TParser* pst, TTokens* out, int capacity);
+
+// the same, and write the normalized form of each token in an arena,
+// once the token is parsed (its characters are still in cache): no
+// other pass over the text is needed. returns 0 too when the arena is
+// full (the parser stops before the token). an arena of twice the
+// length of the string is always enough.
+int get_tokens_norm(TParser* pst,
+  TTokens* out,
+  TNorms* norms,
+  int capacity);
+
+// the same, for utf-8 strings (stored in `_str`): positions and
+// lengths (pos, tidx, tlen, strlen) are in bytes.
+int get_token_utf8(TParser* pst);
+int get_token_dfa_utf8(TParser* pst);
+int get_tokens_utf8(TParser* pst, TTokens* out, int capacity);
+int get_tokens_norm_utf8(TParser* pst,
+  TTokens* out,
+  TNorms* norms,
+  int capacity);
+void init_parser_utf8(TParser* pst, char* str, int len);
+
 // token types identifiers
 #define TS_ANY -2
 #define TS_START -1
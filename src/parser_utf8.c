@@ -0,0 +1,6 @@
+/* the same functions as in parser.c, for utf-8 strings (positions
+ * and lengths are in bytes). see encoding.h.
+ */
+
+#define JUSQUCI_UTF8
+#include "parser.c"
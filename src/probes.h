@@ -0,0 +1,53 @@
+#ifndef PROBES_H
+#define PROBES_H
+
+/* static tracing probes (usdt), for perf or bpftrace: a probe is a
+ * single `nop` in the code, and a note in the binary (its name and
+ * where its arguments are). it costs nothing when nobody is tracing.
+ * they are compiled when <sys/sdt.h> is found (systemtap-sdt-dev: a
+ * header only, no library), unless JUSQUCI_NO_PROBES is defined.
+ *
+ *    provider  name        arguments
+ *    jusquci   init        length of the text, utf-8 (1) or not (0)
+ *    jusquci   doc_start   length of the text
+ *    jusquci   doc_end     length of the text, number of tokens
+ *    jusquci   token       start, length, type (JUSQUCI_TOKEN_PROBES)
+ *
+ * `init` is fired by `init_parser` (each parser, each segment of a
+ * parallel tokenization), `doc_start` and `doc_end` by the postgresql
+ * parser (start, end) and by the python `tokenize`. the lengths are
+ * in bytes for utf-8, in characters otherwise. the probes of each
+ * token are only compiled with JUSQUCI_TOKEN_PROBES:
+ *
+ *    bpftrace -e 'usdt:./jusquci.so:jusquci:doc_end { @[arg1] = count() }'
+ */
+
+#if !defined(JUSQUCI_NO_PROBES) && defined(__has_include)
+#if __has_include(<sys/sdt.h>)
+#include <sys/sdt.h>
+#define JUSQUCI_PROBES
+#endif
+#endif
+
+#ifdef JUSQUCI_PROBES
+
+#define PROBE_INIT(len, utf8) DTRACE_PROBE2(jusquci, init, len, utf8)
+#define PROBE_DOC_START(len) DTRACE_PROBE1(jusquci, doc_start, len)
+#define PROBE_DOC_END(len, n) DTRACE_PROBE2(jusquci, doc_end, len, n)
+
+#else
+
+#define PROBE_INIT(len, utf8) ((void)0)
+#define PROBE_DOC_START(len) ((void)0)
+#define PROBE_DOC_END(len, n) ((void)0)
+
+#endif
+
+#if defined(JUSQUCI_PROBES) && defined(JUSQUCI_TOKEN_PROBES)
+#define PROBE_TOKEN(start, len, ttype)                                      \
+  DTRACE_PROBE3(jusquci, token, start, len, ttype)
+#else
+#define PROBE_TOKEN(start, len, ttype) ((void)0)
+#endif
+
+#endif
@@ -1,25 +1,24 @@
 #include "punct.h"
 #include "util.h"
-#include <wctype.h>
 
 /* :happy: */
 int
-is_emoji(TParser* pst)
+JFN(is_emoji)(TParser* pst)
 {
   jchar c;
-  jchar* p = &pst->str[pst->pos];
-  int remain = pst->strlen - pst->pos;
+  int i = pst->pos + 1;
 
-  if (pst->strlen - pst->pos > 2) {
+  /* at least three characters: ':', something, ':' */
+  if (i < pst->strlen && JNEXT(pst, i) < pst->strlen) {
 
-    for (int i = 1; i < remain; i++) {
-      c = p[i];
+    for (; i < pst->strlen; i = JNEXT(pst, i)) {
+      c = JCH(pst, i);
 
       if (c == L':') {
-        return i + 1;
+        return i + 1 - pst->pos;
       }
 
-      if (!iswalnum(c) && c != L'_')
+      if (!jiswalnum(c) && c != L'_')
         break;
     }
   }
@@ -29,10 +28,9 @@ is_emoji(TParser* pst)
 
 /* ^^ */
 int
-is_emoticon_super(TParser* pst)
+JFN(is_emoticon_super)(TParser* pst)
 {
-  jchar* p = &pst->str[pst->pos];
-  if (pst->strlen - pst->pos > 1 && p[1] == '^') {
+  if (pst->strlen - pst->pos > 1 && JCH(pst, pst->pos + 1) == '^') {
     return 2;
   }
   return 0;
@@ -40,35 +38,32 @@ is_emoticon_super(TParser* pst)
 
 /* ---> */
 int
-is_arrow(TParser* pst)
+JFN(is_arrow)(TParser* pst)
 {
   int remain = (pst->strlen - pst->pos);
-  jchar* p = &pst->str[pst->pos];
-  jchar c = p[0];
+  jchar c = JCH(pst, pst->pos);
   int i = 0;
-  while (i < remain && p[i] == c)
+  while (i < remain && JCH(pst, pst->pos + i) == c)
     i++;
-  if (remain - i && p[i] == '>')
+  if (remain - i && JCH(pst, pst->pos + i) == '>')
     return i+1;
   return i ;
 }
 
 /* (socio)anthropologique */
 int
-is_intrapar_start(TParser* pst, jchar opening)
+JFN(is_intrapar_start)(TParser* pst, jchar opening)
 {
-  int startpos = pst->pos;
-  int i = startpos;
+  int i = pst->pos + 1;
   jchar c;
   jchar closing = (opening == '(') ? ')' : ']';
 
-  while (++i < pst->strlen) {
-    c = pst->str[i];
+  for (; i < pst->strlen; i = JNEXT(pst, i)) {
+    c = JCH(pst, i);
 
     /* it's an intraword parenthese. update current position */
-    if (c == closing && i < pst->strlen &&
-        iswordch(pst->str[++i])) {
-      pst->pos = i;
+    if (c == closing && JMORE(pst, i + 1) && iswordch(JCH(pst, i + 1))) {
+      pst->pos = i + 1;
       return 1;
     }
 
@@ -83,29 +78,31 @@ is_intrapar_start(TParser* pst, jchar opening)
 
 /* ô.ô */
 int
-is_face_emoticon(TParser* pst)
+JFN(is_face_emoticon)(TParser* pst)
 {
-  jchar* str = &pst->str[pst->pos];
-  int remain = pst->strlen - pst->pos;
+  int i = JNEXT(pst, pst->pos); /* '.' or '_' (ascii) */
+  int end;
 
-  if (remain < 3)
+  if (i + 1 >= pst->strlen)
     return 0;
 
-  if (towlower(str[0]) != towlower(str[2]) ||
-      (str[1] != '.' && str[1] != '_'))
+  if (jtowlower(JCH(pst, pst->pos)) != jtowlower(JCH(pst, i + 1)) ||
+      (JCH(pst, i) != '.' && JCH(pst, i) != '_'))
     return 0;
 
-  if (remain == 3 || !iswalpha(str[3]))
-    return 3; /* o.o, x_x */
+  end = JNEXT(pst, i + 1);
+  if (end == pst->strlen || !jiswalpha(JCH(pst, end)))
+    return end - pst->pos; /* o.o, x_x */
 
   return 0;
 }
 
 /* :-) */
 int
-is_side_emoticon(TParser* pst, int eyesfirst)
+JFN(is_side_emoticon)(TParser* pst, int eyesfirst)
 {
-  jchar* p = &pst->str[pst->pos];
+  /* the emoticon is made of ascii characters only, so there is no
+   * need to use JNEXT here. */
   int len = pst->strlen - pst->pos;
   int emolen;
 
@@ -114,14 +111,14 @@ is_side_emoticon(TParser* pst, int eyesfirst)
     return 0;
 
   /* nose only with dash */
-  emolen = (p[1] == '-') ? 2 : 1;
+  emolen = (JCH(pst, pst->pos + 1) == '-') ? 2 : 1;
 
   /* if eyes + nose reach the end, it's not a smiley. */
   if (len < emolen + 1)
     return 0;
 
   /* eyes or mouth, depending of what was matched before */
-  switch (p[emolen]) {
+  switch (JCH(pst, pst->pos + emolen)) {
     case ':':
     case ';':
       if (eyesfirst)
@@ -152,7 +149,7 @@ is_side_emoticon(TParser* pst, int eyesfirst)
   emolen++;
 
   if (pst->strlen - pst->pos == emolen ||
-      !iswalpha(p[emolen])) {
+      !jiswalpha(JCH(pst, pst->pos + emolen))) {
     return emolen;
   }
 
@@ -1,5 +1,6 @@
 #ifndef PUNCT_H
 #define PUNCT_H
+#include "encoding.h"
 #include "parser.h"
 
 /* these function do not modify the TParser directly, but returns
@@ -7,15 +8,15 @@
  * substring is found.
  */
 int
-is_intrapar_start(TParser* pst, jchar opening);
+JFN(is_intrapar_start)(TParser* pst, jchar opening);
 int
-is_face_emoticon(TParser* pst);
+JFN(is_face_emoticon)(TParser* pst);
 int
-is_side_emoticon(TParser* pst, int eyesfirst);
+JFN(is_side_emoticon)(TParser* pst, int eyesfirst);
 int
-is_emoticon_super(TParser* pst);
+JFN(is_emoticon_super)(TParser* pst);
 int
-is_emoji(TParser* pst);
+JFN(is_emoji)(TParser* pst);
 int
-is_arrow(TParser* pst);
+JFN(is_arrow)(TParser* pst);
 #endif
@@ -0,0 +1,185 @@
+#include "scan.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define SCAN_X86
+#include <immintrin.h>
+#endif
+
+/* a run is made of characters in one (or two) ranges of ascii
+ * characters. `mask` is or-ed to the character before the first
+ * range is checked (0x20: case insensitive). a character is in a
+ * range if (c - lo) < n, as unsigned integers.
+ */
+typedef struct
+{
+  unsigned int mask;
+  unsigned int lo1;
+  unsigned int n1;
+  unsigned int lo2;
+  unsigned int n2;
+} scanrange;
+
+static const scanrange ranges[] = {
+  /* Scan_Alpha */
+  { 0x20, 'a', 26, 0, 0 },
+  /* Scan_Space */
+  { 0, '\t', 5, ' ', 1 },
+  /* Scan_Url */
+  { 0, 0x21, 0x5e, 0, 0 },
+};
+
+static inline int
+inrun(unsigned int c, const scanrange* r)
+{
+  return ((c | r->mask) - r->lo1) < r->n1 || (c - r->lo2) < r->n2;
+}
+
+static int
+skip_run32_scalar(const jchar* s, int i, int end, int kind)
+{
+  const scanrange* r = &ranges[kind];
+  while (i < end && inrun(s[i], r))
+    i++;
+  return i;
+}
+
+static int
+skip_run8_scalar(const unsigned char* s, int i, int end, int kind)
+{
+  const scanrange* r = &ranges[kind];
+  while (i < end && inrun(s[i], r))
+    i++;
+  return i;
+}
+
+#ifdef SCAN_X86
+
+/* unsigned comparisons are made with signed ones, flipping the sign
+ * bit of both sides. */
+
+__attribute__((target("sse2"))) static int
+skip_run32_sse2(const jchar* s, int i, int end, int kind)
+{
+  const scanrange* r = &ranges[kind];
+  const __m128i sign = _mm_set1_epi32(INT32_MIN);
+  const __m128i mask = _mm_set1_epi32((int)r->mask);
+  const __m128i lo1 = _mm_set1_epi32((int)r->lo1);
+  const __m128i lo2 = _mm_set1_epi32((int)r->lo2);
+  const __m128i n1 = _mm_xor_si128(_mm_set1_epi32((int)r->n1), sign);
+  const __m128i n2 = _mm_xor_si128(_mm_set1_epi32((int)r->n2), sign);
+
+  for (; i + 4 <= end; i += 4) {
+    __m128i c = _mm_loadu_si128((const __m128i*)(s + i));
+    __m128i x1 = _mm_sub_epi32(_mm_or_si128(c, mask), lo1);
+    __m128i x2 = _mm_sub_epi32(c, lo2);
+    __m128i in =
+      _mm_or_si128(_mm_cmplt_epi32(_mm_xor_si128(x1, sign), n1),
+                   _mm_cmplt_epi32(_mm_xor_si128(x2, sign), n2));
+    int stop = ~_mm_movemask_ps(_mm_castsi128_ps(in)) & 0xf;
+    if (stop)
+      return i + __builtin_ctz((unsigned int)stop);
+  }
+
+  return skip_run32_scalar(s, i, end, kind);
+}
+
+__attribute__((target("sse2"))) static int
+skip_run8_sse2(const unsigned char* s, int i, int end, int kind)
+{
+  const scanrange* r = &ranges[kind];
+  const __m128i sign = _mm_set1_epi8((char)0x80);
+  const __m128i mask = _mm_set1_epi8((char)r->mask);
+  const __m128i lo1 = _mm_set1_epi8((char)r->lo1);
+  const __m128i lo2 = _mm_set1_epi8((char)r->lo2);
+  const __m128i n1 = _mm_xor_si128(_mm_set1_epi8((char)r->n1), sign);
+  const __m128i n2 = _mm_xor_si128(_mm_set1_epi8((char)r->n2), sign);
+
+  for (; i + 16 <= end; i += 16) {
+    __m128i c = _mm_loadu_si128((const __m128i*)(s + i));
+    __m128i x1 = _mm_sub_epi8(_mm_or_si128(c, mask), lo1);
+    __m128i x2 = _mm_sub_epi8(c, lo2);
+    __m128i in =
+      _mm_or_si128(_mm_cmplt_epi8(_mm_xor_si128(x1, sign), n1),
+                   _mm_cmplt_epi8(_mm_xor_si128(x2, sign), n2));
+    int stop = ~_mm_movemask_epi8(in) & 0xffff;
+    if (stop)
+      return i + __builtin_ctz((unsigned int)stop);
+  }
+
+  return skip_run8_scalar(s, i, end, kind);
+}
+
+__attribute__((target("avx2"))) static int
+skip_run32_avx2(const jchar* s, int i, int end, int kind)
+{
+  const scanrange* r = &ranges[kind];
+  const __m256i sign = _mm256_set1_epi32(INT32_MIN);
+  const __m256i mask = _mm256_set1_epi32((int)r->mask);
+  const __m256i lo1 = _mm256_set1_epi32((int)r->lo1);
+  const __m256i lo2 = _mm256_set1_epi32((int)r->lo2);
+  const __m256i n1 = _mm256_xor_si256(_mm256_set1_epi32((int)r->n1), sign);
+  const __m256i n2 = _mm256_xor_si256(_mm256_set1_epi32((int)r->n2), sign);
+
+  for (; i + 8 <= end; i += 8) {
+    __m256i c = _mm256_loadu_si256((const __m256i*)(s + i));
+    __m256i x1 = _mm256_sub_epi32(_mm256_or_si256(c, mask), lo1);
+    __m256i x2 = _mm256_sub_epi32(c, lo2);
+    __m256i in = _mm256_or_si256(
+      _mm256_cmpgt_epi32(n1, _mm256_xor_si256(x1, sign)),
+      _mm256_cmpgt_epi32(n2, _mm256_xor_si256(x2, sign)));
+    int stop = ~_mm256_movemask_ps(_mm256_castsi256_ps(in)) & 0xff;
+    if (stop)
+      return i + __builtin_ctz((unsigned int)stop);
+  }
+
+  return skip_run32_sse2(s, i, end, kind);
+}
+
+__attribute__((target("avx2"))) static int
+skip_run8_avx2(const unsigned char* s, int i, int end, int kind)
+{
+  const scanrange* r = &ranges[kind];
+  const __m256i sign = _mm256_set1_epi8((char)0x80);
+  const __m256i mask = _mm256_set1_epi8((char)r->mask);
+  const __m256i lo1 = _mm256_set1_epi8((char)r->lo1);
+  const __m256i lo2 = _mm256_set1_epi8((char)r->lo2);
+  const __m256i n1 = _mm256_xor_si256(_mm256_set1_epi8((char)r->n1), sign);
+  const __m256i n2 = _mm256_xor_si256(_mm256_set1_epi8((char)r->n2), sign);
+
+  for (; i + 32 <= end; i += 32) {
+    __m256i c = _mm256_loadu_si256((const __m256i*)(s + i));
+    __m256i x1 = _mm256_sub_epi8(_mm256_or_si256(c, mask), lo1);
+    __m256i x2 = _mm256_sub_epi8(c, lo2);
+    __m256i in = _mm256_or_si256(
+      _mm256_cmpgt_epi8(n1, _mm256_xor_si256(x1, sign)),
+      _mm256_cmpgt_epi8(n2, _mm256_xor_si256(x2, sign)));
+    unsigned int stop = ~(unsigned int)_mm256_movemask_epi8(in);
+    if (stop)
+      return i + __builtin_ctz(stop);
+  }
+
+  return skip_run8_sse2(s, i, end, kind);
+}
+
+#endif
+
+int (*skip_run32)(const jchar* s, int i, int end, int kind) =
+  skip_run32_scalar;
+int (*skip_run8)(const unsigned char* s, int i, int end, int kind) =
+  skip_run8_scalar;
+
+/* choose the functions for this cpu, when the library is loaded. */
+__attribute__((constructor)) static void
+init_scan(void)
+{
+#ifdef SCAN_X86
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2")) {
+    skip_run32 = skip_run32_avx2;
+    skip_run8 = skip_run8_avx2;
+  } else if (__builtin_cpu_supports("sse2")) {
+    skip_run32 = skip_run32_sse2;
+    skip_run8 = skip_run8_sse2;
+  }
+#endif
+}
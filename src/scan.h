@@ -0,0 +1,27 @@
+#ifndef SCAN_H
+#define SCAN_H
+
+#include "parser.h"
+
+/* runs of ascii characters are skipped many characters at once
+ * (sse2 or avx2, if the cpu has it). the parser does its usual work
+ * only on the characters where these runs stop.
+ */
+
+/* kinds of runs */
+enum ScanKind
+{
+  Scan_Alpha = 0, /* a-z, A-Z */
+  Scan_Space,     /* ' ', \t, \n, \v, \f, \r */
+  Scan_Url,       /* any ascii character but spaces and controls */
+};
+
+/* returns the index of the first character, from `i`, that is not in
+ * the run (or `end`). the first one works on code points (jchar*),
+ * the second one on bytes (utf-8). the functions are chosen when the
+ * library is loaded, depending on the cpu.
+ */
+extern int (*skip_run32)(const jchar* s, int i, int end, int kind);
+extern int (*skip_run8)(const unsigned char* s, int i, int end, int kind);
+
+#endif
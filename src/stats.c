@@ -0,0 +1,25 @@
+#include "stats.h"
+
+unsigned long long jusquci_stats[N_STATS];
+
+#define STATS_NAME(id, name) name,
+const char* const jusquci_stats_names[N_STATS] = { STATS_LIST(
+  STATS_NAME) };
+#undef STATS_NAME
+
+int
+stats_enabled(void)
+{
+#ifdef JUSQUCI_STATS
+  return 1;
+#else
+  return 0;
+#endif
+}
+
+void
+reset_stats(void)
+{
+  for (int i = 0; i < N_STATS; i++)
+    __atomic_store_n(&jusquci_stats[i], 0, __ATOMIC_RELAXED);
+}
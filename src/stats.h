@@ -0,0 +1,109 @@
+#ifndef STATS_H
+#define STATS_H
+
+/* hot-path counters, for an instrumented build (-DJUSQUCI_STATS): how
+ * often each branch of `get_token` is taken, how often each recognizer
+ * (punct.c, affixes.c, `parse_url`) is called and finds something,
+ * and how many characters are read, compared to the characters of the
+ * tokens (the difference is read more than once). without
+ * JUSQUCI_STATS, the macros are the expressions themselves: there is
+ * no cost at all.
+ *
+ * the counters are global (for all the parsers, and all the threads),
+ * from the start of the process or the last `reset_stats`.
+ */
+
+/* the counters: identifier, name */
+#define STATS_LIST(X)                                                       \
+  X(Stat_Tokens, "tokens")                                                  \
+  X(Stat_Chars, "chars.parsed")                                             \
+  X(Stat_Reads, "chars.read")                                               \
+  X(Stat_DfaTokens, "dfa.tokens")                                           \
+  X(Stat_DfaBails, "dfa.bails")                                             \
+  X(Stat_BrNul, "branch.nul")                                               \
+  X(Stat_BrSpace, "branch.space")                                           \
+  X(Stat_BrNewline, "branch.newline")                                       \
+  X(Stat_BrPeriodCentered, "branch.periodcentered")                         \
+  X(Stat_BrColon, "branch.colon")                                           \
+  X(Stat_BrSemicolon, "branch.semicolon")                                   \
+  X(Stat_BrEqual, "branch.equal")                                           \
+  X(Stat_BrCaret, "branch.caret")                                           \
+  X(Stat_BrX, "branch.x")                                                   \
+  X(Stat_BrFace, "branch.face")                                             \
+  X(Stat_BrParen, "branch.paren")                                           \
+  X(Stat_BrUrl, "branch.url")                                               \
+  X(Stat_BrHyphen, "branch.hyphen")                                         \
+  X(Stat_BrDefault, "branch.default")                                       \
+  X(Stat_ChWord, "chtype.word")                                             \
+  X(Stat_ChDigit, "chtype.digit")                                           \
+  X(Stat_ChRun, "chtype.run")                                               \
+  X(Stat_ChCiteKey, "chtype.citekey")                                       \
+  X(Stat_ChPunct, "chtype.punct")                                           \
+  X(Stat_IsEmoji, "is_emoji.calls")                                         \
+  X(Stat_IsEmojiHit, "is_emoji.hits")                                       \
+  X(Stat_IsSideEmoticon, "is_side_emoticon.calls")                          \
+  X(Stat_IsSideEmoticonHit, "is_side_emoticon.hits")                        \
+  X(Stat_IsFaceEmoticon, "is_face_emoticon.calls")                          \
+  X(Stat_IsFaceEmoticonHit, "is_face_emoticon.hits")                        \
+  X(Stat_IsEmoticonSuper, "is_emoticon_super.calls")                        \
+  X(Stat_IsEmoticonSuperHit, "is_emoticon_super.hits")                      \
+  X(Stat_IsArrow, "is_arrow.calls")                                         \
+  X(Stat_IsArrowHit, "is_arrow.hits")                                       \
+  X(Stat_IsIntraparStart, "is_intrapar_start.calls")                        \
+  X(Stat_IsIntraparStartHit, "is_intrapar_start.hits")                      \
+  X(Stat_ParseUrl, "parse_url.calls")                                       \
+  X(Stat_ParseUrlHit, "parse_url.hits")                                     \
+  X(Stat_IsInversion, "is_inversion.calls")                                 \
+  X(Stat_IsInversionHit, "is_inversion.hits")                               \
+  X(Stat_IsInclSuff, "is_incl_suff.calls")                                  \
+  X(Stat_IsInclSuffHit, "is_incl_suff.hits")                                \
+  X(Stat_IsAbbrev, "is_abbrev.calls")                                       \
+  X(Stat_IsAbbrevHit, "is_abbrev.hits")                                     \
+  X(Stat_MatchOrdinal, "match_ordinal.calls")                               \
+  X(Stat_MatchOrdinalHit, "match_ordinal.hits")
+
+#define STATS_ENUM(id, name) id,
+enum StatId
+{
+  STATS_LIST(STATS_ENUM) N_STATS
+};
+#undef STATS_ENUM
+
+extern unsigned long long jusquci_stats[N_STATS];
+extern const char* const jusquci_stats_names[N_STATS];
+
+// the counters were compiled (JUSQUCI_STATS)
+int stats_enabled(void);
+void reset_stats(void);
+
+#ifdef JUSQUCI_STATS
+
+static inline void
+stat_add(int id, unsigned long long n)
+{
+  __atomic_fetch_add(&jusquci_stats[id], n, __ATOMIC_RELAXED);
+}
+
+/* a recognizer call (the hits are counted at id + 1) */
+static inline int
+stat_hit(int id, int found)
+{
+  stat_add(id, 1);
+  if (found)
+    stat_add(id + 1, 1);
+  return found;
+}
+
+#define STAT(id) stat_add(id, 1)
+#define STAT_ADD(id, n) stat_add(id, (unsigned long long)(n))
+#define STAT_HIT(id, call) stat_hit(id, call)
+
+#else
+
+#define STAT(id) ((void)0)
+#define STAT_ADD(id, n) ((void)0)
+#define STAT_HIT(id, call) (call)
+
+#endif
+
+#endif
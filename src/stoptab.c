@@ -0,0 +1,711 @@
+/* generated by tools/mkstoptab.c -- do not edit. */
+
+#include "terms.h"
+
+const uint16_t stop_seeds[STOP_BUCKETS] = {
+      1,     4,    11,     1,     2,     5,     1,     4,     5,     1,
+      1,     1,     1,     1,     3,     3,     1,     2,     4,     1,
+      1,     1,     1,     1,     1,     1,     1,     1,     1,     4,
+      1,     1,     1,     1,     1,     1,     2,     1,     3,     2,
+      3,     3,     5,     2,     1,     3,     1,     1,     3,     1,
+      5,     4,     9,     3,     1,     1,     1,     3,     1,     9,
+      1,     1,     1,     1,
+};
+
+const jchar stop_chars[] = {
+  0x61, 0x75,
+  0x61, 0x75, 0x78,
+  0x61, 0x76, 0x65, 0x63,
+  0x63, 0x65,
+  0x63, 0x65, 0x73,
+  0x64, 0x61, 0x6e, 0x73,
+  0x64, 0x65,
+  0x64, 0x65, 0x73,
+  0x64, 0x75,
+  0x65, 0x6c, 0x6c, 0x65,
+  0x65, 0x6e,
+  0x65, 0x74,
+  0x65, 0x75, 0x78,
+  0x69, 0x6c,
+  0x69, 0x6c, 0x73,
+  0x6a, 0x65,
+  0x6c, 0x61,
+  0x6c, 0x65,
+  0x6c, 0x65, 0x73,
+  0x6c, 0x65, 0x75, 0x72,
+  0x6c, 0x75, 0x69,
+  0x6d, 0x61,
+  0x6d, 0x61, 0x69, 0x73,
+  0x6d, 0x65,
+  0x6d, 0xea, 0x6d, 0x65,
+  0x6d, 0x65, 0x6d, 0x65,
+  0x6d, 0x65, 0x73,
+  0x6d, 0x6f, 0x69,
+  0x6d, 0x6f, 0x6e,
+  0x6e, 0x65,
+  0x6e, 0x6f, 0x73,
+  0x6e, 0x6f, 0x74, 0x72, 0x65,
+  0x6e, 0x6f, 0x75, 0x73,
+  0x6f, 0x6e,
+  0x6f, 0x75,
+  0x70, 0x61, 0x72,
+  0x70, 0x61, 0x73,
+  0x70, 0x6f, 0x75, 0x72,
+  0x71, 0x75,
+  0x71, 0x75, 0x65,
+  0x71, 0x75, 0x69,
+  0x73, 0x61,
+  0x73, 0x65,
+  0x73, 0x65, 0x73,
+  0x73, 0x6f, 0x6e,
+  0x73, 0x75, 0x72,
+  0x74, 0x61,
+  0x74, 0x65,
+  0x74, 0x65, 0x73,
+  0x74, 0x6f, 0x69,
+  0x74, 0x6f, 0x6e,
+  0x74, 0x75,
+  0x75, 0x6e,
+  0x75, 0x6e, 0x65,
+  0x76, 0x6f, 0x73,
+  0x76, 0x6f, 0x74, 0x72, 0x65,
+  0x76, 0x6f, 0x75, 0x73,
+  0x63,
+  0x64,
+  0x6a,
+  0x6c,
+  0xe0,
+  0x61,
+  0x6d,
+  0x6e,
+  0x73,
+  0x74,
+  0x79,
+  0xe9, 0x74, 0xe9,
+  0x65, 0x74, 0x65,
+  0xe9, 0x74, 0xe9, 0x65,
+  0x65, 0x74, 0x65, 0x65,
+  0xe9, 0x74, 0xe9, 0x65, 0x73,
+  0x65, 0x74, 0x65, 0x65, 0x73,
+  0xe9, 0x74, 0xe9, 0x73,
+  0x65, 0x74, 0x65, 0x73,
+  0xe9, 0x74, 0x61, 0x6e, 0x74,
+  0x65, 0x74, 0x61, 0x6e, 0x74,
+  0xe9, 0x74, 0x61, 0x6e, 0x74, 0x65,
+  0x65, 0x74, 0x61, 0x6e, 0x74, 0x65,
+  0xe9, 0x74, 0x61, 0x6e, 0x74, 0x73,
+  0x65, 0x74, 0x61, 0x6e, 0x74, 0x73,
+  0xe9, 0x74, 0x61, 0x6e, 0x74, 0x65, 0x73,
+  0x65, 0x74, 0x61, 0x6e, 0x74, 0x65, 0x73,
+  0x73, 0x75, 0x69, 0x73,
+  0x65, 0x73,
+  0x65, 0x73, 0x74,
+  0x73, 0x6f, 0x6d, 0x6d, 0x65, 0x73,
+  0xea, 0x74, 0x65, 0x73,
+  0x73, 0x6f, 0x6e, 0x74,
+  0x73, 0x65, 0x72, 0x61, 0x69,
+  0x73, 0x65, 0x72, 0x61, 0x73,
+  0x73, 0x65, 0x72, 0x61,
+  0x73, 0x65, 0x72, 0x6f, 0x6e, 0x73,
+  0x73, 0x65, 0x72, 0x65, 0x7a,
+  0x73, 0x65, 0x72, 0x6f, 0x6e, 0x74,
+  0x73, 0x65, 0x72, 0x61, 0x69, 0x73,
+  0x73, 0x65, 0x72, 0x61, 0x69, 0x74,
+  0x73, 0x65, 0x72, 0x69, 0x6f, 0x6e, 0x73,
+  0x73, 0x65, 0x72, 0x69, 0x65, 0x7a,
+  0x73, 0x65, 0x72, 0x61, 0x69, 0x65, 0x6e, 0x74,
+  0xe9, 0x74, 0x61, 0x69, 0x73,
+  0x65, 0x74, 0x61, 0x69, 0x73,
+  0xe9, 0x74, 0x61, 0x69, 0x74,
+  0x65, 0x74, 0x61, 0x69, 0x74,
+  0xe9, 0x74, 0x69, 0x6f, 0x6e, 0x73,
+  0x65, 0x74, 0x69, 0x6f, 0x6e, 0x73,
+  0xe9, 0x74, 0x69, 0x65, 0x7a,
+  0x65, 0x74, 0x69, 0x65, 0x7a,
+  0xe9, 0x74, 0x61, 0x69, 0x65, 0x6e, 0x74,
+  0x65, 0x74, 0x61, 0x69, 0x65, 0x6e, 0x74,
+  0x66, 0x75, 0x73,
+  0x66, 0x75, 0x74,
+  0x66, 0xfb, 0x6d, 0x65, 0x73,
+  0x66, 0x75, 0x6d, 0x65, 0x73,
+  0x66, 0xfb, 0x74, 0x65, 0x73,
+  0x66, 0x75, 0x74, 0x65, 0x73,
+  0x66, 0x75, 0x72, 0x65, 0x6e, 0x74,
+  0x73, 0x6f, 0x69, 0x73,
+  0x73, 0x6f, 0x69, 0x74,
+  0x73, 0x6f, 0x79, 0x6f, 0x6e, 0x73,
+  0x73, 0x6f, 0x79, 0x65, 0x7a,
+  0x73, 0x6f, 0x69, 0x65, 0x6e, 0x74,
+  0x66, 0x75, 0x73, 0x73, 0x65,
+  0x66, 0x75, 0x73, 0x73, 0x65, 0x73,
+  0x66, 0xfb, 0x74,
+  0x66, 0x75, 0x73, 0x73, 0x69, 0x6f, 0x6e, 0x73,
+  0x66, 0x75, 0x73, 0x73, 0x69, 0x65, 0x7a,
+  0x66, 0x75, 0x73, 0x73, 0x65, 0x6e, 0x74,
+  0x61, 0x79, 0x61, 0x6e, 0x74,
+  0x61, 0x79, 0x61, 0x6e, 0x74, 0x65,
+  0x61, 0x79, 0x61, 0x6e, 0x74, 0x65, 0x73,
+  0x61, 0x79, 0x61, 0x6e, 0x74, 0x73,
+  0x65, 0x75,
+  0x65, 0x75, 0x65,
+  0x65, 0x75, 0x65, 0x73,
+  0x65, 0x75, 0x73,
+  0x61, 0x69,
+  0x61, 0x73,
+  0x61, 0x76, 0x6f, 0x6e, 0x73,
+  0x61, 0x76, 0x65, 0x7a,
+  0x6f, 0x6e, 0x74,
+  0x61, 0x75, 0x72, 0x61, 0x69,
+  0x61, 0x75, 0x72, 0x61, 0x73,
+  0x61, 0x75, 0x72, 0x61,
+  0x61, 0x75, 0x72, 0x6f, 0x6e, 0x73,
+  0x61, 0x75, 0x72, 0x65, 0x7a,
+  0x61, 0x75, 0x72, 0x6f, 0x6e, 0x74,
+  0x61, 0x75, 0x72, 0x61, 0x69, 0x73,
+  0x61, 0x75, 0x72, 0x61, 0x69, 0x74,
+  0x61, 0x75, 0x72, 0x69, 0x6f, 0x6e, 0x73,
+  0x61, 0x75, 0x72, 0x69, 0x65, 0x7a,
+  0x61, 0x75, 0x72, 0x61, 0x69, 0x65, 0x6e, 0x74,
+  0x61, 0x76, 0x61, 0x69, 0x73,
+  0x61, 0x76, 0x61, 0x69, 0x74,
+  0x61, 0x76, 0x69, 0x6f, 0x6e, 0x73,
+  0x61, 0x76, 0x69, 0x65, 0x7a,
+  0x61, 0x76, 0x61, 0x69, 0x65, 0x6e, 0x74,
+  0x65, 0x75, 0x74,
+  0x65, 0xfb, 0x6d, 0x65, 0x73,
+  0x65, 0x75, 0x6d, 0x65, 0x73,
+  0x65, 0xfb, 0x74, 0x65, 0x73,
+  0x65, 0x75, 0x74, 0x65, 0x73,
+  0x65, 0x75, 0x72, 0x65, 0x6e, 0x74,
+  0x61, 0x69, 0x65,
+  0x61, 0x69, 0x65, 0x73,
+  0x61, 0x69, 0x74,
+  0x61, 0x79, 0x6f, 0x6e, 0x73,
+  0x61, 0x79, 0x65, 0x7a,
+  0x61, 0x69, 0x65, 0x6e, 0x74,
+  0x65, 0x75, 0x73, 0x73, 0x65,
+  0x65, 0x75, 0x73, 0x73, 0x65, 0x73,
+  0x65, 0xfb, 0x74,
+  0x65, 0x75, 0x73, 0x73, 0x69, 0x6f, 0x6e, 0x73,
+  0x65, 0x75, 0x73, 0x73, 0x69, 0x65, 0x7a,
+  0x65, 0x75, 0x73, 0x73, 0x65, 0x6e, 0x74,
+  0x6a, 0x75, 0x73, 0x71, 0x75,
+  0x6c, 0x6f, 0x72, 0x73, 0x71, 0x75,
+  0x70, 0x75, 0x69, 0x73, 0x71, 0x75,
+  0x71, 0x75, 0x6f, 0x69, 0x71, 0x75,
+};
+
+const stopslot stop_slots[STOP_SIZE] = {
+  { 234, 6 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 291, 6 },
+  { 0, 0 },
+  { 0, 0 },
+  { 2, 3 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 383, 7 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 50, 4 },
+  { 308, 6 },
+  { 0, 0 },
+  { 228, 6 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 14, 4 },
+  { 0, 0 },
+  { 84, 3 },
+  { 0, 0 },
+  { 63, 2 },
+  { 172, 1 },
+  { 263, 6 },
+  { 0, 0 },
+  { 5, 4 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 112, 3 },
+  { 0, 0 },
+  { 678, 4 },
+  { 0, 0 },
+  { 0, 0 },
+  { 222, 6 },
+  { 556, 6 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 598, 8 },
+  { 622, 5 },
+  { 670, 3 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 423, 6 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 247, 7 },
+  { 523, 3 },
+  { 320, 7 },
+  { 673, 5 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 682, 5 },
+  { 0, 0 },
+  { 0, 0 },
+  { 495, 6 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 585, 7 },
+  { 356, 5 },
+  { 0, 0 },
+  { 0, 0 },
+  { 167, 1 },
+  { 573, 6 },
+  { 0, 0 },
+  { 0, 0 },
+  { 206, 5 },
+  { 73, 3 },
+  { 0, 0 },
+  { 0, 0 },
+  { 59, 4 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 166, 1 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 211, 5 },
+  { 361, 6 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 133, 2 },
+  { 0, 0 },
+  { 429, 4 },
+  { 0, 0 },
+  { 698, 3 },
+  { 0, 0 },
+  { 0, 0 },
+  { 519, 4 },
+  { 465, 3 },
+  { 43, 2 },
+  { 177, 3 },
+  { 0, 0 },
+  { 0, 0 },
+  { 188, 5 },
+  { 0, 0 },
+  { 535, 4 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 734, 6 },
+  { 269, 4 },
+  { 0, 0 },
+  { 184, 4 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 45, 2 },
+  { 0, 0 },
+  { 0, 0 },
+  { 96, 2 },
+  { 0, 0 },
+  { 76, 3 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 170, 1 },
+  { 87, 5 },
+  { 0, 0 },
+  { 23, 2 },
+  { 637, 5 },
+  { 592, 6 },
+  { 490, 5 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 526, 2 },
+  { 0, 0 },
+  { 547, 5 },
+  { 148, 3 },
+  { 0, 0 },
+  { 351, 5 },
+  { 0, 0 },
+  { 98, 2 },
+  { 258, 2 },
+  { 0, 0 },
+  { 0, 0 },
+  { 9, 2 },
+  { 0, 0 },
+  { 728, 6 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 346, 5 },
+  { 193, 5 },
+  { 29, 2 },
+  { 110, 2 },
+  { 0, 0 },
+  { 54, 3 },
+  { 0, 0 },
+  { 138, 3 },
+  { 240, 7 },
+  { 0, 0 },
+  { 282, 5 },
+  { 69, 4 },
+  { 25, 4 },
+  { 273, 4 },
+  { 606, 5 },
+  { 567, 6 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 652, 5 },
+  { 0, 0 },
+  { 254, 4 },
+  { 0, 0 },
+  { 0, 0 },
+  { 390, 7 },
+  { 36, 2 },
+  { 627, 7 },
+  { 0, 0 },
+  { 611, 5 },
+  { 0, 0 },
+  { 106, 4 },
+  { 0, 0 },
+  { 0, 0 },
+  { 171, 1 },
+  { 0, 0 },
+  { 542, 5 },
+  { 165, 1 },
+  { 0, 0 },
+  { 0, 0 },
+  { 163, 1 },
+  { 0, 0 },
+  { 0, 0 },
+  { 164, 1 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 146, 2 },
+  { 378, 5 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 413, 5 },
+  { 103, 3 },
+  { 552, 4 },
+  { 120, 2 },
+  { 277, 5 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 528, 2 },
+  { 0, 0 },
+  { 459, 6 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 287, 4 },
+  { 0, 0 },
+  { 47, 3 },
+  { 0, 0 },
+  { 297, 5 },
+  { 0, 0 },
+  { 82, 2 },
+  { 0, 0 },
+  { 198, 4 },
+  { 418, 5 },
+  { 0, 0 },
+  { 128, 3 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 41, 2 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 122, 3 },
+  { 0, 0 },
+  { 11, 3 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 397, 3 },
+  { 0, 0 },
+  { 125, 3 },
+  { 0, 0 },
+  { 0, 0 },
+  { 468, 8 },
+  { 0, 0 },
+  { 0, 0 },
+  { 20, 3 },
+  { 0, 0 },
+  { 31, 2 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 516, 3 },
+  { 501, 7 },
+  { 38, 3 },
+  { 408, 5 },
+  { 100, 3 },
+  { 448, 6 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 634, 3 },
+  { 709, 7 },
+  { 0, 0 },
+  { 18, 2 },
+  { 0, 0 },
+  { 0, 0 },
+  { 154, 5 },
+  { 0, 0 },
+  { 403, 5 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 539, 3 },
+  { 65, 4 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 740, 6 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 692, 6 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 180, 4 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 174, 3 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 202, 4 },
+  { 0, 0 },
+  { 373, 5 },
+  { 0, 0 },
+  { 0, 0 },
+  { 514, 2 },
+  { 0, 0 },
+  { 0, 0 },
+  { 579, 6 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 79, 3 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 135, 3 },
+  { 0, 0 },
+  { 0, 0 },
+  { 169, 1 },
+  { 0, 0 },
+  { 0, 0 },
+  { 687, 5 },
+  { 0, 0 },
+  { 0, 0 },
+  { 647, 5 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 333, 8 },
+  { 0, 0 },
+  { 173, 1 },
+  { 0, 0 },
+  { 0, 0 },
+  { 33, 3 },
+  { 433, 4 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 476, 7 },
+  { 0, 0 },
+  { 0, 0 },
+  { 530, 5 },
+  { 663, 3 },
+  { 0, 0 },
+  { 0, 0 },
+  { 723, 5 },
+  { 0, 0 },
+  { 716, 7 },
+  { 0, 0 },
+  { 483, 7 },
+  { 0, 0 },
+  { 131, 2 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 666, 4 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 302, 6 },
+  { 0, 0 },
+  { 168, 1 },
+  { 0, 0 },
+  { 216, 6 },
+  { 0, 0 },
+  { 0, 0 },
+  { 367, 6 },
+  { 0, 0 },
+  { 115, 3 },
+  { 0, 0 },
+  { 0, 0 },
+  { 144, 2 },
+  { 159, 4 },
+  { 260, 3 },
+  { 0, 0 },
+  { 0, 0 },
+  { 437, 6 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 57, 2 },
+  { 0, 0 },
+  { 118, 2 },
+  { 151, 3 },
+  { 0, 0 },
+  { 0, 0 },
+  { 657, 6 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 2 },
+  { 642, 5 },
+  { 0, 0 },
+  { 327, 6 },
+  { 508, 6 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 616, 6 },
+  { 701, 8 },
+  { 0, 0 },
+  { 141, 3 },
+  { 0, 0 },
+  { 562, 5 },
+  { 400, 3 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 454, 5 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 443, 5 },
+  { 92, 4 },
+  { 0, 0 },
+  { 0, 0 },
+  { 314, 6 },
+  { 341, 5 },
+};
@@ -0,0 +1,161 @@
+#include "stream.h"
+#include "chartab.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define STREAM_BASE_SIZE 256
+
+void
+init_stream(TStream* st)
+{
+  /* keep the buffer, if any (it's the same stream, for a new text). */
+  if (st->size <= 0) {
+    st->buf = NULL;
+    st->size = 0;
+  }
+
+  st->len = 0;
+  st->safe = 0;
+  st->done = 0;
+  st->offset = 0;
+  init_parser(&st->pst, st->buf, 0);
+}
+
+void
+free_stream(TStream* st)
+{
+  free(st->buf);
+  st->buf = NULL;
+  st->size = 0;
+}
+
+int
+find_resync(const jchar* str, int start, int end)
+{
+  if (start < 1)
+    start = 1;
+
+  for (int i = end - 1; i >= start; i--) {
+    if (jiswspace(str[i - 1]) && !jiswspace(str[i]))
+      return i;
+  }
+
+  return 0;
+}
+
+int
+feed_stream(TStream* st, const jchar* chunk, int len)
+{
+  int pos = st->pst.pos;
+  int prev = st->len;
+
+  if (st->done)
+    return 0;
+
+  /* drop the text already parsed */
+  if (pos) {
+    memmove(st->buf, &st->buf[pos], sizeof(jchar) * (size_t)(st->len - pos));
+    st->len -= pos;
+    st->safe = (st->safe > pos) ? st->safe - pos : 0;
+    st->offset += pos;
+    prev -= pos;
+  }
+
+  /* make some space */
+  if (st->len + len > st->size) {
+    int size = st->size ? st->size : STREAM_BASE_SIZE;
+    while (size < st->len + len)
+      size *= 2;
+    jchar* temp =
+      realloc(st->buf, sizeof(jchar) * (size_t)(size + JUSQUCI_PAD));
+    if (!temp)
+      return -1;
+    st->buf = temp;
+    st->size = size;
+  }
+
+  memcpy(&st->buf[st->len], chunk, sizeof(jchar) * (size_t)len);
+  st->len += len;
+  if (st->buf)
+    memset(&st->buf[st->len], 0, sizeof(jchar) * JUSQUCI_PAD);
+
+  /* a new safe position can only be in the new text */
+  int safe = find_resync(st->buf, prev, st->len);
+  if (safe > st->safe)
+    st->safe = safe;
+
+  /* the parser keeps its state (`_prev`, `_next`) */
+  st->pst.str = st->buf;
+  st->pst.pos = 0;
+  st->pst.strlen = st->safe;
+
+  return 0;
+}
+
+void
+finish_stream(TStream* st)
+{
+  st->done = 1;
+  st->safe = st->len;
+  st->pst.strlen = st->len;
+}
+
+int
+get_stream_tokens(TStream* st, TTokens* out, int capacity)
+{
+  TParser* pst = &st->pst;
+  int n;
+
+  /* the parser can be after `safe` (see below): it never goes back. */
+  pst->strlen = (st->safe > pst->pos) ? st->safe : pst->pos;
+
+  /* the padding is at the end of the text, once it's finished */
+  pst->padded = st->done;
+  n = get_tokens_norm(pst, out, st->norms, capacity);
+
+  /* a '\0' ends the text, as with `get_token`. */
+  if (!n && pst->pos < pst->strlen && !st->buf[pst->pos]) {
+    st->len = pst->pos;
+    finish_stream(st);
+    return 0;
+  }
+
+  /* no safe point: with a maximum length, a token that starts more
+   * than `maxlen` before the end of the buffer sees the same text as
+   * in the whole text, so the buffer doesn't grow with the length of
+   * a sequence of non-space characters. */
+  if (!n && !st->done && pst->maxlen > 0) {
+    unsigned int types = pst->types;
+
+    /* one token at a time: the filter is checked here. */
+    pst->types = TYPES_ALL;
+    pst->strlen = st->len;
+    while (n < capacity && st->len - pst->pos > pst->maxlen) {
+      TTokens one = { &out->start[n], &out->len[n], &out->type[n],
+                      &out->flags[n], out->hash ? &out->hash[n] : NULL,
+                      out->lhash ? &out->lhash[n] : NULL,
+                      out->shape ? &out->shape[n] : NULL };
+      TNorms norm;
+      if (st->norms) {
+        norm = *st->norms;
+        norm.start += n;
+        norm.len += n;
+      }
+      if (!get_tokens_norm(pst, &one, st->norms ? &norm : NULL, 1)) {
+        if (st->norms && st->buf[pst->pos])
+          break;
+        st->len = pst->pos;
+        finish_stream(st);
+        break;
+      }
+      if (!(types & TYPE_BIT(out->type[n])))
+        continue;
+      if (st->norms)
+        st->norms->used = norm.used;
+      n++;
+    }
+    pst->types = types;
+  }
+
+  return n;
+}
@@ -0,0 +1,53 @@
+#ifndef STREAM_H
+#define STREAM_H
+
+#include "parser.h"
+
+/* a text given by chunks (streaming). the tokens are parsed only when
+ * they are complete, that is when they are followed by a safe point
+ * (see `find_resync`), where the tokenization would be the same if it
+ * was started from there. so the memory used is bounded by the
+ * longest sequence of non-space characters, not by the length of the
+ * text, and the tokens are the same as with `get_token` on the whole
+ * text. with a maximum length of tokens (`pst.maxlen`), it is bounded
+ * by this length.
+ */
+typedef struct
+{
+  TParser pst;  // parses the text in `buf`, up to `safe` (at least)
+  jchar* buf;   // the text not yet parsed (and the last tokens),
+                // followed by JUSQUCI_PAD '\0' (see `pst->padded`)
+  int len;      // length of the text in `buf`
+  int size;     // allocated size of `buf`
+  int safe;     // tokens before this position can be parsed
+  int done;     // no more text will be added
+  long offset;  // position of `buf` in the whole text
+  TNorms* norms; // the normalized forms (get_tokens_norm), or NULL
+} TStream;
+
+// start a (new) text. the buffer can be reused between texts.
+void init_stream(TStream* st);
+void free_stream(TStream* st);
+
+// add a chunk of text (ignored once the text is finished). returns
+// 0, or -1 if memory can't be allocated.
+// the tokens previously returned are no longer valid.
+int feed_stream(TStream* st, const jchar* chunk, int len);
+
+// there is no more text.
+void finish_stream(TStream* st);
+
+// get the tokens that are complete, like `get_tokens`: 0 means that
+// more text is needed (or that the text is finished). the positions
+// of the tokens are in `st->buf`. with `st->norms`, the normalized
+// forms are written too: the arena must be at least twice as long as
+// `st->len` (else 0 can be returned before the end of the text).
+int get_stream_tokens(TStream* st, TTokens* out, int capacity);
+
+// the last position, before `end`, where the tokenization can start
+// again from nothing: after a space, before something that is not a
+// space. no token (but spaces) is longer, nor looks further, than
+// the next space. returns 0 if there is no such position.
+int find_resync(const jchar* str, int start, int end);
+
+#endif
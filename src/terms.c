@@ -0,0 +1,318 @@
+#include "terms.h"
+#include "chartab.h"
+#include "util.h"
+#include <string.h>
+
+int
+is_stopword(const jchar* word, int len)
+{
+  uint32_t bucket, slot;
+  const stopslot* s;
+
+  if (len <= 0 || len > STOP_LEN_MAX)
+    return 0;
+
+  bucket = stop_hash(0, word, len) & (STOP_BUCKETS - 1);
+  slot = stop_hash(stop_seeds[bucket], word, len) & (STOP_SIZE - 1);
+  s = &stop_slots[slot];
+
+  return s->len == len &&
+         !memcmp(&stop_chars[s->first], word, sizeof(jchar) * (size_t)len);
+}
+
+/* the light stemmer of J. Savoy (for french): the first rule that
+ * matches is applied (and the next ones too, if `next`). a rule is
+ * applied if the word is longer than `min`. */
+typedef struct
+{
+  const jchar* suffix;
+  int min;
+  const jchar* replacement;
+  int next;
+} stemrule;
+
+static const stemrule stem_rules[] = {
+  { U"issement", 9, U"ir", 0 },
+  { U"issant", 8, U"ir", 0 },
+  { U"ivement", 6, U"if", 0 },
+  { U"ement", 6, U"e", 0 },
+  { U"ficatrice", 11, U"fier", 0 },
+  { U"ficateur", 10, U"fier", 0 },
+  { U"catrice", 9, U"quer", 0 },
+  { U"cateur", 8, U"quer", 0 },
+  { U"atrice", 8, U"er", 0 },
+  { U"ateur", 7, U"er", 0 },
+  { U"trice", 6, U"teur", 1 },
+  { U"ième", 5, U"", 0 },
+  { U"teuse", 7, U"ter", 0 },
+  { U"teur", 6, U"ter", 0 },
+  { U"euse", 5, U"eu", 0 },
+  { U"ère", 8, U"er", 0 },
+  { U"ive", 7, U"if", 0 },
+  { U"folle", 4, U"fou", 0 },
+  { U"molle", 4, U"mou", 0 },
+  { U"nnelle", 9, U"n", 0 },
+  { U"nnel", 9, U"n", 0 },
+  { U"ète", 4, U"et", 1 },
+  { U"ique", 8, U"", 1 },
+  { U"esse", 8, U"e", 0 },
+  { U"inage", 7, U"in", 0 },
+  { U"ualisation", 9, U"uel", 0 },
+  { U"isation", 9, U"", 0 },
+  { U"isateur", 9, U"", 0 },
+  { U"ation", 8, U"", 0 },
+  { U"ition", 8, U"", 0 },
+};
+
+#define N_STEM_RULES (int)(sizeof(stem_rules) / sizeof(stem_rules[0]))
+
+static int
+jlen(const jchar* s)
+{
+  int len = 0;
+
+  while (s[len])
+    len++;
+
+  return len;
+}
+
+static int
+ends_with(const jchar* word, int len, const jchar* suffix, int slen)
+{
+  return len >= slen &&
+         !memcmp(&word[len - slen], suffix, sizeof(jchar) * (size_t)slen);
+}
+
+/* the diacritics of the stems */
+static jchar
+unaccent(jchar c)
+{
+  switch (c) {
+    case L'à':
+    case L'á':
+    case L'â':
+      return L'a';
+    case L'ô':
+      return L'o';
+    case L'è':
+    case L'é':
+    case L'ê':
+      return L'e';
+    case L'ù':
+    case L'û':
+      return L'u';
+    case L'î':
+      return L'i';
+    case L'ç':
+      return L'c';
+    default:
+      return c;
+  }
+}
+
+/* the end of every stem: no diacritics (nor the combining marks that
+ * are not composed), no double letters, and without the final "ie",
+ * "r", "e". */
+static int
+stem_norm(jchar* word, int len)
+{
+  if (len > 4) {
+    int n = 1;
+
+    word[0] = unaccent(word[0]);
+    for (int i = 1; i < len; i++) {
+      jchar c = unaccent(word[i]);
+      if (jiswdiacritic(c))
+        continue;
+      if (c != word[n - 1] || !jiswalpha(c))
+        word[n++] = c;
+    }
+    len = n;
+  }
+
+  if (len > 4 && word[len - 2] == L'i' && word[len - 1] == L'e')
+    len -= 2;
+
+  if (len > 4) {
+    if (word[len - 1] == L'r')
+      len--;
+    if (word[len - 1] == L'e')
+      len--;
+    if (word[len - 1] == L'e')
+      len--;
+    if (word[len - 1] == word[len - 2] && jiswalpha(word[len - 1]))
+      len--;
+  }
+
+  return len;
+}
+
+int
+stem_light(jchar* word, int len)
+{
+  /* the plural: chevaux -> cheval, lieux -> lieu, mots -> mot */
+  if (len > 5 && word[len - 1] == L'x') {
+    if (word[len - 3] == L'a' && word[len - 2] == L'u' &&
+        word[len - 4] != L'e')
+      word[len - 2] = L'l';
+    len--;
+  }
+  if (len > 3 && word[len - 1] == L'x')
+    len--;
+  if (len > 3 && word[len - 1] == L's')
+    len--;
+
+  for (int i = 0; i < N_STEM_RULES; i++) {
+    const stemrule* r = &stem_rules[i];
+    int slen = jlen(r->suffix);
+    int rlen = jlen(r->replacement);
+
+    if (len <= r->min || !ends_with(word, len, r->suffix, slen))
+      continue;
+
+    len -= slen;
+    memcpy(&word[len], r->replacement, sizeof(jchar) * (size_t)rlen);
+    len += rlen;
+    if (!r->next)
+      break;
+  }
+
+  return stem_norm(word, len);
+}
+
+/* the letters of a decomposed word (nfd), composed in place: "e" +
+ * U+0301 -> "é" (see `jch_compose`). returns its new length. */
+static int
+compose(jchar* word, int len)
+{
+  int n = 0;
+
+  for (int i = 0; i < len; i++) {
+    jchar c;
+
+    if (n && jiswdiacritic(word[i]) &&
+        (c = jch_compose(word[n - 1], word[i]))) {
+      word[n - 1] = c;
+      continue;
+    }
+    word[n++] = word[i];
+  }
+
+  return n;
+}
+
+int
+make_term(jchar* word, int len)
+{
+  int first = 0;
+
+  /* the stopwords and the stems are in nfc */
+  len = compose(word, len);
+
+  /* the inversions: "-ce", "-t-il" */
+  while (first < len && word[first] == L'-')
+    first++;
+  if (first) {
+    len -= first;
+    memmove(word, &word[first], sizeof(jchar) * (size_t)len);
+  }
+
+  /* the inclusive suffixes ("enseignant·e·s", "ami.e.s": the parser
+   * splits the other words at a dot) and the final dots: the term is
+   * the word before the first separator, as the masculine form. */
+  for (int i = 1; i < len; i++) {
+    if (word[i] == L'·' || word[i] == L'.') {
+      len = i;
+      break;
+    }
+  }
+
+  while (len > 0 && (word[len - 1] == L'\'' || word[len - 1] == L'’'))
+    len--;
+
+  if (!len || is_stopword(word, len))
+    return 0;
+
+  return stem_light(word, len);
+}
+
+int
+norm_word(jchar* dst, const jchar* word, int len, int opts)
+{
+  int k = 0;
+
+  for (int i = 0; i < len; i++) {
+    jchar c = (opts & NORM_LOWER) ? jtowlower(word[i]) : word[i];
+    unsigned int fold = (opts & NORM_UNACCENT) ? jch_fold(c) : 0;
+
+    if ((opts & NORM_UNACCENT) && jiswdiacritic(c))
+      continue;
+    if (fold) {
+      dst[k++] = fold & 0xff;
+      if (fold >> 8)
+        dst[k++] = fold >> 8;
+    } else
+      dst[k++] = c;
+  }
+
+  return k;
+}
+
+int
+make_terms(TTokens* tokens, TNorms* norms, int n)
+{
+  jchar* buf = norms->buf;
+  int used = n ? (int)norms->start[0] : norms->used;
+  int k = 0;
+
+  /* the normalized forms are in order in the arena, and a term is
+   * never longer than its form: it's moved back. */
+  for (int i = 0; i < n; i++) {
+    jchar* word = &buf[norms->start[i]];
+    int len;
+
+    if (!IS_TERM(tokens->type[i]))
+      continue;
+    if (!(len = make_term(word, (int)norms->len[i])))
+      continue;
+
+    memmove(&buf[used], word, sizeof(jchar) * (size_t)len);
+    tokens->start[k] = tokens->start[i];
+    tokens->len[k] = tokens->len[i];
+    tokens->type[k] = tokens->type[i];
+    tokens->flags[k] = tokens->flags[i];
+    if (tokens->hash)
+      tokens->hash[k] = tokens->hash[i];
+    if (tokens->lhash)
+      tokens->lhash[k] = tokens->lhash[i];
+    if (tokens->shape)
+      tokens->shape[k] = tokens->shape[i];
+    norms->start[k] = (uint32_t)used;
+    norms->len[k] = (uint32_t)len;
+    used += len;
+    k++;
+  }
+  norms->used = used;
+
+  return k;
+}
+
+int
+get_terms(TParser* pst, TTokens* out, TNorms* terms, int capacity)
+{
+  int opts = terms->opts;
+  unsigned int types = pst->types;
+  int n;
+
+  /* a batch can have no terms (only stopwords) */
+  terms->opts |= NORM_LOWER;
+  pst->types &= TERM_TYPES;
+  do {
+    n = get_tokens_norm(pst, out, terms, capacity);
+  } while (n && !(n = make_terms(out, terms, n)));
+  terms->opts = opts;
+  pst->types = types;
+
+  return n;
+}
@@ -0,0 +1,84 @@
+#ifndef TERMS_H
+#define TERMS_H
+
+#include "parser.h"
+
+/* index terms: the words of a text (TS_WORD, TS_ABBREV), lowercase,
+ * without the stopwords, and lightly stemmed (the plural, the feminine
+ * and some derivational suffixes are removed: "chanteuses" ->
+ * "chant"). it's a stage after the parser, on the normalized forms
+ * (see get_tokens_norm), for code points only.
+ *
+ * the stopwords (lexicon/stopwords.txt) are in a perfect hash table
+ * (tools/mkstoptab.c): a word is found with two hashes and a single
+ * comparison. the words are placed in two steps: the first hash
+ * selects a bucket, and each bucket has its own seed for the second
+ * hash, chosen so that its words fall in free slots.
+ */
+
+/* the tokens that are terms (TERM_TYPES: the filter of the parser,
+ * see `pst->types`) */
+#define IS_TERM(ttype) ((ttype) == TS_WORD || (ttype) == TS_ABBREV)
+#define TERM_TYPES (TYPE_BIT(TS_WORD) | TYPE_BIT(TS_ABBREV))
+
+/* the size of the table (powers of 2) */
+#define STOP_BUCKETS 64
+#define STOP_SIZE 512
+#define STOP_LEN_MAX 16
+
+/* a slot of the table: the word is `stop_chars[first]` (len 0 if the
+ * slot is empty). */
+typedef struct
+{
+  uint16_t first;
+  uint16_t len;
+} stopslot;
+
+extern const uint16_t stop_seeds[STOP_BUCKETS];
+extern const stopslot stop_slots[STOP_SIZE];
+extern const jchar stop_chars[];
+
+/* fnv-1a on code points */
+static inline uint32_t
+stop_hash(uint32_t seed, const jchar* word, int len)
+{
+  uint32_t h = 2166136261u ^ seed;
+
+  for (int i = 0; i < len; i++) {
+    h ^= word[i];
+    h *= 16777619u;
+  }
+
+  return h ^ (h >> 16);
+}
+
+// is the word (lowercase) a stopword?
+int is_stopword(const jchar* word, int len);
+
+// stem a word (lowercase) in place. returns its new length.
+int stem_light(jchar* word, int len);
+
+// the term of a normalized form, in place (in nfc): the first hyphens
+// (inversions: "-ce"), the inclusive suffixes ("ami·e·s"), the final
+// apostrophes (elision: "l'", "qu'") and dots (abbreviations) are
+// removed, and the word is stemmed.
+// returns its length, 0 for a stopword.
+int make_term(jchar* word, int len);
+
+// the normalized form (NORM_*) of a single word, written in `dst`
+// (twice as long as the word). returns its length.
+int norm_word(jchar* dst, const jchar* word, int len, int opts);
+
+// keep the terms of a batch of tokens and of their normalized forms
+// (lowercase: NORM_LOWER), in place: the arena is compacted. returns
+// the number of terms.
+int make_terms(TTokens* tokens, TNorms* norms, int n);
+
+// parse up to `capacity` tokens, and keep their terms (like
+// `get_tokens_norm`, then `make_terms`). NORM_LOWER is always set, and
+// the other types are skipped by the parser (TERM_TYPES).
+// returns the number of terms, 0 when the end of the string is
+// reached (or when the arena is full).
+int get_terms(TParser* pst, TTokens* out, TNorms* terms, int capacity);
+
+#endif
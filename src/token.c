@@ -0,0 +1,446 @@
+/* the tokenizer itself (the first switch of `get_token`, and the
+ * words), compiled once per variant from the same source: each variant
+ * is specialized for some options of the parser (OPT_*), known at
+ * compile time (JUSQUCI_OPTS), so that the branches of the disabled
+ * options are removed, and not only skipped. without JUSQUCI_OPTS, the
+ * options are read from the parser (`pst->opts`): any combination.
+ *
+ *    file                  variant  options
+ *    token.c               _opts    pst->opts
+ *    token_all.c           _all     OPT_ALL (the default)
+ *    token_plain.c         _plain   OPT_NONE (no emoticons, emojis,
+ *                                   citekeys, inclusive suffixes)
+ *    token_pad.c           _pad     OPT_ALL, padded strings
+ *
+ * each one for utf-8 strings too (token_*utf8.c). `get_token` chooses
+ * the variant for the options of the parser. the end of the string is
+ * checked with JMORE (see encoding.h): for a padded string
+ * (`pst->padded`), the loops stop on the '\0' after it instead.
+ */
+
+#include "affixes.h"
+#include "encoding.h"
+#include "lexicon.h"
+#include "parser.h"
+#include "probes.h"
+#include "punct.h"
+#include "util.h"
+
+#ifndef JUSQUCI_VARIANT
+#define JUSQUCI_VARIANT _opts
+#endif
+
+#define JVFN(name) JFN(JCAT(name, JUSQUCI_VARIANT))
+
+#ifdef JUSQUCI_OPTS
+#define JOPT(pst, opt) ((JUSQUCI_OPTS) & (opt))
+#else
+#define JOPT(pst, opt) ((pst)->opts & (opt))
+#endif
+
+/* in parser.c */
+int
+JFN(parse_url)(TParser* pst, jchar c);
+void
+JFN(parse_citekey)(TParser* pst);
+int
+JFN(parse_digit)(TParser* pst);
+
+static int
+JVFN(parse_word)(TParser* pst)
+{
+  jchar c = JCH(pst, pst->pos);
+  int par = 0;
+  int len;
+
+  while (JMORE(pst, pst->pos)) {
+
+    /* plain letters need no check */
+    pst->pos = JSKIP(pst, pst->pos, Scan_Alpha);
+    if (!JMORE(pst, pst->pos))
+      break;
+
+    c = JCH(pst, pst->pos);
+
+    switch (c) {
+
+      /* opening parentheses */
+      case '(':
+      case '[':
+      case '{':
+        par = 1;
+        break;
+
+      /* closing parentheses */
+      case ')':
+      case ']':
+      case '}':
+        if (!par)
+          return TS_WORD;
+        par = 0;
+        break;
+
+      case '-':
+        /* depuis->là */
+        if (!JMORE(pst, pst->pos + 1) ||
+            !jiswalpha(JCH(pst, pst->pos + 1))) {
+          return TS_WORD;
+        }
+        /* penses-tu */
+        else if (STAT_HIT(Stat_IsInversion, JFN(is_inversion)(pst))) {
+          pst->_next = TS_WORD;
+          return TS_WORD;
+        }
+        break;
+
+      /* dots */
+      case '.':
+        /* auteur.rice */
+        if (JOPT(pst, OPT_INCLUSIVE) &&
+            (len = STAT_HIT(Stat_IsInclSuff, JFN(is_incl_suff)(pst, c)))) {
+          pst->pos += len;
+          continue;
+        }
+        /* p. ex. */
+        else if (STAT_HIT(Stat_IsAbbrev, JFN(is_abbrev)(pst))) {
+          pst->pos++;
+          return TS_ABBREV;
+        }
+        /* Adieu. */
+        else {
+          return TS_WORD;
+        }
+        break;
+
+      /* very minimal support for "·ère": it's not check, just */
+      /* assumed that it is inclusive language. */
+      case L'·':
+        if (JOPT(pst, OPT_INCLUSIVE) && JMORE(pst, JNEXT(pst, pst->pos)) &&
+            jiswalpha(JCH(pst, JNEXT(pst, pst->pos)))) {
+          pst->pos = JNEXT(pst, pst->pos);
+        } else {
+          return TS_WORD;
+        }
+        break;
+
+      /* n° 47 */
+      case L'°':
+        pst->pos = JNEXT(pst, pst->pos);
+        return TS_ABBREV;
+
+      /* jusqu' ici */
+      case '\'':
+      case L'’':
+      case L'‘':
+        pst->pos = JNEXT(pst, pst->pos);
+        return TS_WORD;
+        break;
+
+      default:
+        if (!iswordch(c))
+          return TS_WORD;
+        break;
+    }
+
+    pst->pos = JNEXT(pst, pst->pos);
+  }
+
+  return TS_WORD;
+}
+
+int
+JVFN(parse_token)(TParser* pst)
+{
+  jchar c;
+  int chtype; /* character type */
+  int ttype;  /* token type */
+  int tlen;
+
+  /* reach the end */
+  if (pst->pos >= pst->strlen) {
+    pst->pos = pst->strlen;
+    pst->tidx = pst->strlen;
+    pst->tlen = 0;
+    return TS_END;
+  }
+
+  c = JCH(pst, pst->pos); /* current character */
+  pst->tidx = pst->pos;   /* the token start index */
+
+  switch (c) {
+
+    /* end of string. it should not get to this point. */
+    case L'\0':
+      STAT(Stat_BrNul);
+      ttype = TS_END;
+      chtype = Ch_Ctrl;
+      goto EndToken;
+      break;
+
+    /* simple white space */
+    case L' ':
+      STAT(Stat_BrSpace);
+      chtype = Ch_Space;
+      if (pst->_prev == TS_SPACE) {
+        ttype = TS_SPACESIGN;
+      } else {
+        ttype = TS_SPACE;
+        pst->pos++;
+        goto EndToken;
+      }
+      break;
+
+    /* newline */
+    case L'\n':
+      STAT(Stat_BrNewline);
+      ttype = TS_NEWLINE;
+      chtype = Ch_Space;
+      pst->pos++;
+      goto EndToken;
+      break;
+
+    /* periodcentered is a punct sign unless it's inside a word */
+    case L'·':
+      STAT(Stat_BrPeriodCentered);
+      ttype = TS_PUNCT;
+      chtype = Ch_Punct;
+      pst->pos = JNEXT(pst, pst->pos);
+      goto EndToken;
+      break;
+
+    case L':':
+      STAT(Stat_BrColon);
+      chtype = Ch_PunctEndSent;
+      /* :happy: */
+      if (JOPT(pst, OPT_EMOJIS) &&
+          (tlen = STAT_HIT(Stat_IsEmoji, JFN(is_emoji)(pst)))) {
+        ttype = TS_EMOJI;
+        pst->pos += tlen;
+        /* :-) */
+      } else if (JOPT(pst, OPT_EMOTICONS) &&
+                 (tlen = STAT_HIT(Stat_IsSideEmoticon,
+                    JFN(is_side_emoticon)(pst, 1)))) {
+        ttype = TS_EMOTICON;
+        pst->pos += tlen;
+        /* default usage */
+      } else {
+        ttype = TS_PUNCTSTRONG;
+        pst->pos++;
+      }
+      goto EndToken;
+      break;
+
+    case L';':
+      STAT(Stat_BrSemicolon);
+      /* :-) */
+      chtype = Ch_PunctEndSent;
+      if (JOPT(pst, OPT_EMOTICONS) &&
+          (tlen = STAT_HIT(Stat_IsSideEmoticon,
+             JFN(is_side_emoticon)(pst, 1)))) {
+        ttype = TS_EMOTICON;
+        pst->pos += tlen;
+        /* default usage */
+      } else {
+        ttype = TS_PUNCTSTRONG;
+        pst->pos++;
+      }
+      goto EndToken;
+      break;
+
+    case L'=':
+      STAT(Stat_BrEqual);
+      chtype = Ch_Punct;
+      ttype = TS_PUNCT;
+      /* =) */
+      if (JOPT(pst, OPT_EMOTICONS) &&
+          (tlen = STAT_HIT(Stat_IsSideEmoticon,
+             JFN(is_side_emoticon)(pst, 1)))) {
+        ttype = TS_EMOTICON;
+        pst->pos += tlen;
+        goto EndToken;
+        /* ===> */
+      } else if ((tlen = STAT_HIT(Stat_IsArrow, JFN(is_arrow)(pst)))) {
+        pst->pos += tlen;
+        goto EndToken;
+        /* ici = là */
+      } else {
+        pst->pos++;
+        goto EndToken;
+      }
+      break;
+
+    case L'^':
+      STAT(Stat_BrCaret);
+      chtype = Ch_Punct;
+      /* ^^ */
+      if (JOPT(pst, OPT_EMOTICONS) &&
+          (tlen = STAT_HIT(Stat_IsEmoticonSuper,
+             JFN(is_emoticon_super)(pst)))) {
+        ttype = TS_EMOTICON;
+        pst->pos += tlen;
+        /* as an simili-punctuation sign */
+      } else {
+        ttype = TS_PUNCT;
+        pst->pos++;
+      }
+      goto EndToken;
+      break;
+
+    case L'x':
+    case L'X':
+      STAT(Stat_BrX);
+      /* XD, x.x */
+      if (JOPT(pst, OPT_EMOTICONS) &&
+          ((tlen = STAT_HIT(Stat_IsFaceEmoticon,
+              JFN(is_face_emoticon)(pst))) ||
+           (tlen = STAT_HIT(Stat_IsSideEmoticon,
+              JFN(is_side_emoticon)(pst, 1))))) {
+        ttype = TS_EMOTICON;
+        chtype = Ch_Punct;
+        pst->pos += tlen;
+        goto EndToken;
+      } else {
+        chtype = Ch_Word;
+        ttype = TS_WORD;
+      }
+      break;
+
+    case L'v':
+    case L'o':
+    case L'ô':
+    case L'V':
+    case L'O':
+    case L'Ô':
+      STAT(Stat_BrFace);
+      /* v.v ô.ô O_o */
+      if (JOPT(pst, OPT_EMOTICONS) &&
+          (tlen = STAT_HIT(Stat_IsFaceEmoticon,
+             JFN(is_face_emoticon)(pst)))) {
+        ttype = TS_EMOTICON;
+        chtype = Ch_Punct;
+        pst->pos += tlen;
+        goto EndToken;
+      } else {
+        chtype = Ch_Word;
+        ttype = TS_WORD;
+      }
+      break;
+
+    case L'(':
+    case L'[':
+      STAT(Stat_BrParen);
+      /* (: */
+      if (JOPT(pst, OPT_EMOTICONS) &&
+          (tlen = STAT_HIT(Stat_IsSideEmoticon,
+             JFN(is_side_emoticon)(pst, 0)))) {
+        ttype = TS_EMOTICON;
+        pst->pos += tlen;
+        goto EndToken;
+      }
+      chtype = STAT_HIT(Stat_IsIntraparStart,
+                 JFN(is_intrapar_start)(pst, c))
+                 ? Ch_Word
+                 : Ch_Punct;
+      break;
+
+    case L'h':
+    case L'w':
+      STAT(Stat_BrUrl);
+      /* www.on-tenk.com */
+      if (STAT_HIT(Stat_ParseUrl, JFN(parse_url)(pst, c))) {
+        chtype = Ch_Word;
+        ttype = TS_URL;
+        goto EndToken;
+      }
+      ttype = TS_WORD;
+      chtype = Ch_Word;
+      break;
+
+    case L'-':
+      STAT(Stat_BrHyphen);
+      chtype = Ch_Punct;
+      ttype = Ch_Punct;
+      /* -je */
+      if (pst->_next == TS_WORD) {
+        pst->_next = TS_START;
+        pst->pos++;
+        chtype = Ch_Word;
+        ttype = TS_WORD;
+        /* ---> */
+      } else if ((tlen = STAT_HIT(Stat_IsArrow, JFN(is_arrow)(pst)))) {
+        pst->pos += tlen;
+        goto EndToken;
+      } else {
+        pst->pos++;
+        goto EndToken;
+      }
+      break;
+
+    default:
+      STAT(Stat_BrDefault);
+      chtype = getchtype(c);
+      break;
+  }
+
+  switch (chtype) {
+
+    case Ch_Word:
+      STAT(Stat_ChWord);
+      ttype = JVFN(parse_word)(pst);
+      break;
+
+    case Ch_Digit:
+      STAT(Stat_ChDigit);
+      ttype = JFN(parse_digit)(pst);
+      break;
+
+    case Ch_Ctrl:
+    case Ch_Space:
+    case Ch_PunctEndSent:
+      STAT(Stat_ChRun);
+      ttype = chtype;
+      /* a '\0' is a control character (the padding too) */
+      while ((chtype == Ch_Ctrl ? pst->pos < pst->strlen
+                                : JMORE(pst, pst->pos)) &&
+             getchtype(JCH(pst, pst->pos)) == chtype) {
+        pst->pos = JNEXT(pst, pst->pos);
+        if (chtype == Ch_Space)
+          pst->pos = JSKIP(pst, pst->pos, Scan_Space);
+      }
+      break;
+
+    /* @becker1982 (or a punctuation sign, without OPT_CITEKEYS) */
+    case Ch_CiteKeyChar:
+      if (JOPT(pst, OPT_CITEKEYS)) {
+        STAT(Stat_ChCiteKey);
+        ttype = TS_CITEKEY;
+        pst->pos++;
+        JFN(parse_citekey)(pst);
+        break;
+      }
+      /* fall through */
+
+    case Ch_Punct:
+    default:
+      STAT(Stat_ChPunct);
+      pst->pos = JNEXT(pst, pst->pos);
+      ttype = TS_PUNCT;
+      break;
+  }
+
+EndToken:
+
+  /* end of string */
+  if (pst->pos > pst->strlen)
+    pst->pos = pst->strlen;
+
+  /* update the token informations */
+  pst->tlen = pst->pos - pst->tidx;
+  pst->ttype = ttype;
+  pst->_prev = ttype;
+  STAT(Stat_Tokens);
+  STAT_ADD(Stat_Chars, pst->tlen);
+  PROBE_TOKEN(pst->tidx, pst->tlen, ttype);
+
+  return ttype;
+}
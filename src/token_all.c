@@ -0,0 +1,5 @@
+/* the variant of token.c with all the options (OPT_ALL). */
+
+#define JUSQUCI_VARIANT _all
+#define JUSQUCI_OPTS OPT_ALL
+#include "token.c"
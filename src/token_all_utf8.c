@@ -0,0 +1,7 @@
+/* the variant of token.c with all the options (OPT_ALL), for utf-8
+ * strings. */
+
+#define JUSQUCI_UTF8
+#define JUSQUCI_VARIANT _all
+#define JUSQUCI_OPTS OPT_ALL
+#include "token.c"
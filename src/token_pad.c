@@ -0,0 +1,8 @@
+/* the variant of token.c with all the options (OPT_ALL), for padded
+ * strings (`pst->padded`): the loops stop on the '\0' after the end of
+ * the string, and don't compare the positions with `strlen`. */
+
+#define JUSQUCI_PADDED
+#define JUSQUCI_VARIANT _pad
+#define JUSQUCI_OPTS OPT_ALL
+#include "token.c"
@@ -0,0 +1,8 @@
+/* the variant of token.c with all the options (OPT_ALL), for padded
+ * utf-8 strings. */
+
+#define JUSQUCI_UTF8
+#define JUSQUCI_PADDED
+#define JUSQUCI_VARIANT _pad
+#define JUSQUCI_OPTS OPT_ALL
+#include "token.c"
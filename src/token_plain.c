@@ -0,0 +1,5 @@
+/* the variant of token.c without any option (OPT_NONE). */
+
+#define JUSQUCI_VARIANT _plain
+#define JUSQUCI_OPTS OPT_NONE
+#include "token.c"
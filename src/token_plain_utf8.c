@@ -0,0 +1,7 @@
+/* the variant of token.c without any option (OPT_NONE), for utf-8
+ * strings. */
+
+#define JUSQUCI_UTF8
+#define JUSQUCI_VARIANT _plain
+#define JUSQUCI_OPTS OPT_NONE
+#include "token.c"
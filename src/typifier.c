@@ -3,7 +3,7 @@
 // TODO: test
 
 #include "parser.h"
-#include "wctype.h"
+#include "util.h"
 
 int ttypify(jchar* token, int len)
 {
@@ -17,7 +17,7 @@ int ttypify(jchar* token, int len)
   // tokenized and typified as a `TS_PUNCT` instead of `TS_WORD`.
   if (!len)
     ttype = TS_START;
-  else if (len > 1 && token[0] == L'-' && iswalpha(token[1]))
+  else if (len > 1 && token[0] == L'-' && jiswalpha(token[1]))
     ttype = TS_WORD;
   else
     ttype = get_token(&pst);
@@ -1,10 +1,9 @@
 #include "util.h"
-#include "wctype.h"
 
 int
 iswordch(jchar c)
 {
-  return (iswalpha(c) || c == L'·');
+  return (jiswalpha(c) || c == L'·');
 }
 
 /* classify a character */
@@ -12,19 +11,21 @@ int
 getchtype(jchar c)
 {
 
-  if (iswspace(c))
+  if (jiswspace(c))
     return Ch_Space;
 
-  if (iswalpha(c) || c == L'·')
-    return Ch_Word;
+  /* a combining mark is in a word (see `iswordch`), but it doesn't
+   * start one: alone, it's a punctuation sign */
+  if (jiswalpha(c) || c == L'·')
+    return (jch_ctype(c) & JCH_MARK) ? Ch_Punct : Ch_Word;
 
-  if (iswdigit(c))
+  if (jiswdigit(c))
     return Ch_Digit;
 
   if (c == L'@') /* @becker1982 */
     return Ch_CiteKeyChar;
 
-  if (iswcntrl(c))
+  if (jiswcntrl(c))
     return Ch_Ctrl;
 
   switch (c) {
@@ -44,31 +45,110 @@ getchtype(jchar c)
   }
 }
 
-/* compare two strings (second one must be lowercase and \0) */
-size_t
-cmpi(jchar* s_anycase, const jchar* s_lowercase, size_t len)
+/* the canonical compositions of the latin letters (U+00C0-U+017F) of
+ * an ascii letter and a combining mark, sorted by mark and letter. */
+typedef struct
 {
-  size_t i;
-  for (i = 0; i<len; i++) {
-    if (s_lowercase[i] == L'\0')
-      return i;
-    if (towlower(s_anycase[i]) != s_lowercase[i])
-      return 0;
-  }
-  return i;
-}
+  jchar mark;
+  jchar base;
+  jchar composed;
+} composition;
+
+static const composition compositions[] = {
+  /* grave */
+  { 0x0300, 'A', U'À' }, { 0x0300, 'E', U'È' }, { 0x0300, 'I', U'Ì' },
+  { 0x0300, 'O', U'Ò' }, { 0x0300, 'U', U'Ù' }, { 0x0300, 'a', U'à' },
+  { 0x0300, 'e', U'è' }, { 0x0300, 'i', U'ì' }, { 0x0300, 'o', U'ò' },
+  { 0x0300, 'u', U'ù' },
+  /* acute */
+  { 0x0301, 'A', U'Á' }, { 0x0301, 'C', U'Ć' }, { 0x0301, 'E', U'É' },
+  { 0x0301, 'I', U'Í' }, { 0x0301, 'L', U'Ĺ' }, { 0x0301, 'N', U'Ń' },
+  { 0x0301, 'O', U'Ó' }, { 0x0301, 'R', U'Ŕ' }, { 0x0301, 'S', U'Ś' },
+  { 0x0301, 'U', U'Ú' }, { 0x0301, 'Y', U'Ý' }, { 0x0301, 'Z', U'Ź' },
+  { 0x0301, 'a', U'á' }, { 0x0301, 'c', U'ć' }, { 0x0301, 'e', U'é' },
+  { 0x0301, 'i', U'í' }, { 0x0301, 'l', U'ĺ' }, { 0x0301, 'n', U'ń' },
+  { 0x0301, 'o', U'ó' }, { 0x0301, 'r', U'ŕ' }, { 0x0301, 's', U'ś' },
+  { 0x0301, 'u', U'ú' }, { 0x0301, 'y', U'ý' }, { 0x0301, 'z', U'ź' },
+  /* circumflex */
+  { 0x0302, 'A', U'Â' }, { 0x0302, 'C', U'Ĉ' }, { 0x0302, 'E', U'Ê' },
+  { 0x0302, 'G', U'Ĝ' }, { 0x0302, 'H', U'Ĥ' }, { 0x0302, 'I', U'Î' },
+  { 0x0302, 'J', U'Ĵ' }, { 0x0302, 'O', U'Ô' }, { 0x0302, 'S', U'Ŝ' },
+  { 0x0302, 'U', U'Û' }, { 0x0302, 'W', U'Ŵ' }, { 0x0302, 'Y', U'Ŷ' },
+  { 0x0302, 'a', U'â' }, { 0x0302, 'c', U'ĉ' }, { 0x0302, 'e', U'ê' },
+  { 0x0302, 'g', U'ĝ' }, { 0x0302, 'h', U'ĥ' }, { 0x0302, 'i', U'î' },
+  { 0x0302, 'j', U'ĵ' }, { 0x0302, 'o', U'ô' }, { 0x0302, 's', U'ŝ' },
+  { 0x0302, 'u', U'û' }, { 0x0302, 'w', U'ŵ' }, { 0x0302, 'y', U'ŷ' },
+  /* tilde */
+  { 0x0303, 'A', U'Ã' }, { 0x0303, 'I', U'Ĩ' }, { 0x0303, 'N', U'Ñ' },
+  { 0x0303, 'O', U'Õ' }, { 0x0303, 'U', U'Ũ' }, { 0x0303, 'a', U'ã' },
+  { 0x0303, 'i', U'ĩ' }, { 0x0303, 'n', U'ñ' }, { 0x0303, 'o', U'õ' },
+  { 0x0303, 'u', U'ũ' },
+  /* macron */
+  { 0x0304, 'A', U'Ā' }, { 0x0304, 'E', U'Ē' }, { 0x0304, 'I', U'Ī' },
+  { 0x0304, 'O', U'Ō' }, { 0x0304, 'U', U'Ū' }, { 0x0304, 'a', U'ā' },
+  { 0x0304, 'e', U'ē' }, { 0x0304, 'i', U'ī' }, { 0x0304, 'o', U'ō' },
+  { 0x0304, 'u', U'ū' },
+  /* breve */
+  { 0x0306, 'A', U'Ă' }, { 0x0306, 'E', U'Ĕ' }, { 0x0306, 'G', U'Ğ' },
+  { 0x0306, 'I', U'Ĭ' }, { 0x0306, 'O', U'Ŏ' }, { 0x0306, 'U', U'Ŭ' },
+  { 0x0306, 'a', U'ă' }, { 0x0306, 'e', U'ĕ' }, { 0x0306, 'g', U'ğ' },
+  { 0x0306, 'i', U'ĭ' }, { 0x0306, 'o', U'ŏ' }, { 0x0306, 'u', U'ŭ' },
+  /* dot above */
+  { 0x0307, 'C', U'Ċ' }, { 0x0307, 'E', U'Ė' }, { 0x0307, 'G', U'Ġ' },
+  { 0x0307, 'I', U'İ' }, { 0x0307, 'Z', U'Ż' }, { 0x0307, 'c', U'ċ' },
+  { 0x0307, 'e', U'ė' }, { 0x0307, 'g', U'ġ' }, { 0x0307, 'z', U'ż' },
+  /* diaeresis */
+  { 0x0308, 'A', U'Ä' }, { 0x0308, 'E', U'Ë' }, { 0x0308, 'I', U'Ï' },
+  { 0x0308, 'O', U'Ö' }, { 0x0308, 'U', U'Ü' }, { 0x0308, 'Y', U'Ÿ' },
+  { 0x0308, 'a', U'ä' }, { 0x0308, 'e', U'ë' }, { 0x0308, 'i', U'ï' },
+  { 0x0308, 'o', U'ö' }, { 0x0308, 'u', U'ü' }, { 0x0308, 'y', U'ÿ' },
+  /* ring above */
+  { 0x030a, 'A', U'Å' }, { 0x030a, 'U', U'Ů' }, { 0x030a, 'a', U'å' },
+  { 0x030a, 'u', U'ů' },
+  /* double acute */
+  { 0x030b, 'O', U'Ő' }, { 0x030b, 'U', U'Ű' }, { 0x030b, 'o', U'ő' },
+  { 0x030b, 'u', U'ű' },
+  /* caron */
+  { 0x030c, 'C', U'Č' }, { 0x030c, 'D', U'Ď' }, { 0x030c, 'E', U'Ě' },
+  { 0x030c, 'L', U'Ľ' }, { 0x030c, 'N', U'Ň' }, { 0x030c, 'R', U'Ř' },
+  { 0x030c, 'S', U'Š' }, { 0x030c, 'T', U'Ť' }, { 0x030c, 'Z', U'Ž' },
+  { 0x030c, 'c', U'č' }, { 0x030c, 'd', U'ď' }, { 0x030c, 'e', U'ě' },
+  { 0x030c, 'l', U'ľ' }, { 0x030c, 'n', U'ň' }, { 0x030c, 'r', U'ř' },
+  { 0x030c, 's', U'š' }, { 0x030c, 't', U'ť' }, { 0x030c, 'z', U'ž' },
+  /* cedilla */
+  { 0x0327, 'C', U'Ç' }, { 0x0327, 'G', U'Ģ' }, { 0x0327, 'K', U'Ķ' },
+  { 0x0327, 'L', U'Ļ' }, { 0x0327, 'N', U'Ņ' }, { 0x0327, 'R', U'Ŗ' },
+  { 0x0327, 'S', U'Ş' }, { 0x0327, 'T', U'Ţ' }, { 0x0327, 'c', U'ç' },
+  { 0x0327, 'g', U'ģ' }, { 0x0327, 'k', U'ķ' }, { 0x0327, 'l', U'ļ' },
+  { 0x0327, 'n', U'ņ' }, { 0x0327, 'r', U'ŗ' }, { 0x0327, 's', U'ş' },
+  { 0x0327, 't', U'ţ' },
+  /* ogonek */
+  { 0x0328, 'A', U'Ą' }, { 0x0328, 'E', U'Ę' }, { 0x0328, 'I', U'Į' },
+  { 0x0328, 'U', U'Ų' }, { 0x0328, 'a', U'ą' }, { 0x0328, 'e', U'ę' },
+  { 0x0328, 'i', U'į' }, { 0x0328, 'u', U'ų' },
+};
+
+#define N_COMPOSITIONS (int)(sizeof(compositions) / sizeof(compositions[0]))
 
-/* compare a string with an array of strings (lowercased and \0) */
-size_t
-cmpiany(jchar* s,
-  const jchar* const* array,
-  size_t len,
-  size_t arraylen)
+jchar
+jch_compose(jchar base, jchar mark)
 {
-  for (size_t i = 0; i < arraylen; i++) {
-    size_t res = cmpi(s, array[i], len);
-    if (res)
-      return res;
+  int lo = 0;
+  int hi = N_COMPOSITIONS;
+
+  while (lo < hi) {
+    int mid = (lo + hi) / 2;
+    const composition* c = &compositions[mid];
+
+    if (c->mark < mark || (c->mark == mark && c->base < base))
+      lo = mid + 1;
+    else
+      hi = mid;
   }
+
+  if (lo < N_COMPOSITIONS && compositions[lo].mark == mark &&
+      compositions[lo].base == base)
+    return compositions[lo].composed;
+
   return 0;
 }
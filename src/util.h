@@ -1,6 +1,7 @@
 #ifndef UTIL_H
 #define UTIL_H
 
+#include "chartab.h"
 #include "parser.h"
 #include <stdlib.h>
 
@@ -23,14 +24,9 @@ iswordch(jchar c);
 int
 getchtype(jchar c);
 
-// compare two string. (the first string is lowercased.)
-size_t
-cmpi(jchar* s_anycase, const jchar* s_lowercase, size_t len);
-
-size_t
-cmpiany(jchar* s,
-  const jchar* const* array,
-  size_t len,
-  size_t arraylen);
+// the letter of an ascii letter and a combining mark, in a decomposed
+// text (nfd): 'e' + U+0301 -> 'é'. 0 if there is none.
+jchar
+jch_compose(jchar base, jchar mark);
 
 #endif
@@ -0,0 +1,165 @@
+// retokenize must give the same tokens as get_tokens on the whole new
+// text (start, length, type and flags), after random edits: with both
+// engines, some profiles of options, and a maximum length of tokens.
+//
+// usage: edittest FILE... (the start of the files, edited)
+
+#include "../src/edit.h"
+#include <locale.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <wchar.h>
+
+#define TEXT_LEN 8192
+#define MAX_LEN (TEXT_LEN + 1024)
+#define N_EDITS 2000
+
+static const int profiles[] = {
+  OPT_ALL,
+  OPT_NONE,
+  OPT_INCLUSIVE | OPT_EMOTICONS,
+};
+
+static const int maxlens[] = { 0, 8 };
+
+// the inserted texts: the starts and the ends of the tokens
+static const jchar* const inserts[] = {
+  U"",    U" ",  U".",     U"a",  U":-)", U"-tu",        U"\n", U"  ",
+  U"?",   U"e.s", U"·e",  U"'",  U"(s)", U"http://x.y ", U"@a", U"«",
+  U". A", U"1er", U"=)",  U"ô.ô", U"-",
+};
+
+#define N_INSERTS (int)(sizeof(inserts) / sizeof(inserts[0]))
+
+static jchar text[MAX_LEN];
+static uint32_t start[2][MAX_LEN], len[2][MAX_LEN];
+static uint8_t type[2][MAX_LEN], flags[2][MAX_LEN];
+
+static int
+read_text(int argc, char** argv)
+{
+  int n = 0;
+
+  for (int i = 1; i < argc && n < TEXT_LEN; i++) {
+    FILE* f = fopen(argv[i], "r");
+    wint_t c;
+
+    if (!f) {
+      fprintf(stderr, "edittest: cannot read %s.\n", argv[i]);
+      return -1;
+    }
+    while (n < TEXT_LEN && (c = fgetwc(f)) != WEOF)
+      text[n++] = (jchar)c;
+    fclose(f);
+  }
+
+  return n;
+}
+
+static void
+set_parser(TParser* pst, int n, int engine, int opts, int maxlen)
+{
+  init_parser(pst, text, n);
+  pst->engine = engine;
+  pst->opts = opts;
+  pst->maxlen = maxlen;
+}
+
+// the edits of a text, with some settings. returns 1 if the tokens of
+// an edit differ (or if memory can't be allocated).
+static int
+edit_text(int n, int engine, int opts, int maxlen)
+{
+  TEditTokens et = { 0 };
+  TTokens full = { start[1], len[1], type[1], flags[1], NULL, NULL, NULL };
+  TParser pst;
+
+  set_parser(&pst, n, engine, opts, maxlen);
+  if (tokenize_edit(&pst, &et) < 0)
+    return 1;
+
+  for (int k = 0; k < N_EDITS; k++) {
+    const jchar* s = inserts[rand() % N_INSERTS];
+    int offset = rand() % (n + 1);
+    int deleted = rand() % 4;
+    int inserted = 0;
+    int m, r;
+
+    while (s[inserted])
+      inserted++;
+    if (offset + deleted > n)
+      deleted = n - offset;
+    if (n - deleted + inserted >= MAX_LEN)
+      break;
+
+    memmove(&text[offset + inserted], &text[offset + deleted],
+            sizeof(jchar) * (size_t)(n - offset - deleted));
+    memcpy(&text[offset], s, sizeof(jchar) * (size_t)inserted);
+    n += inserted - deleted;
+
+    set_parser(&pst, n, engine, opts, maxlen);
+    if ((m = retokenize(&pst, &et, offset, deleted, inserted)) < 0)
+      return 1;
+    for (int i = 0; i < m; i++) {
+      int x = edit_token(&et, i);
+
+      start[0][i] = edit_token_start(&et, i);
+      len[0][i] = et.tokens.len[x];
+      type[0][i] = et.tokens.type[x];
+      flags[0][i] = et.tokens.flags[x];
+    }
+
+    set_parser(&pst, n, engine, opts, maxlen);
+    r = get_tokens(&pst, &full, MAX_LEN);
+
+    if (m != r || memcmp(start[0], start[1], sizeof(uint32_t) * (size_t)r) ||
+        memcmp(len[0], len[1], sizeof(uint32_t) * (size_t)r) ||
+        memcmp(type[0], type[1], (size_t)r) ||
+        memcmp(flags[0], flags[1], (size_t)r)) {
+      fprintf(stderr,
+              "edittest: engine %d, options %#x, maxlen %d: edit %d "
+              "(%d deleted, %d inserted at %d) differs\n",
+              engine, opts, maxlen, k, deleted, inserted, offset);
+      free_edit_tokens(&et);
+      return 1;
+    }
+  }
+
+  free_edit_tokens(&et);
+
+  return 0;
+}
+
+int
+main(int argc, char** argv)
+{
+  static jchar original[MAX_LEN];
+  int n, runs = 0, failures = 0;
+
+  setlocale(LC_ALL, "C.UTF-8");
+  if (argc < 2) {
+    fputs("usage: edittest FILE...\n", stderr);
+    return 1;
+  }
+  if ((n = read_text(argc, argv)) < 0)
+    return 1;
+  memcpy(original, text, sizeof(jchar) * (size_t)n);
+
+  srand(1);
+  for (int engine = ENGINE_SWITCH; engine <= ENGINE_DFA; engine++) {
+    for (size_t p = 0; p < sizeof(profiles) / sizeof(profiles[0]); p++) {
+      for (size_t m = 0; m < sizeof(maxlens) / sizeof(maxlens[0]); m++) {
+        memcpy(text, original, sizeof(jchar) * (size_t)n);
+        failures += edit_text(n, engine, profiles[p], maxlens[m]);
+        runs++;
+      }
+    }
+  }
+
+  if (failures)
+    return 1;
+  printf("edittest: %d edits, same tokens\n", runs * N_EDITS);
+
+  return 0;
+}
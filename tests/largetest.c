@@ -0,0 +1,194 @@
+// get_large_tokens must give the same tokens as get_tokens_norm on the
+// whole text (positions in the text, length, type, flags, hashes and
+// shapes, and the normalized forms), with small windows: in both
+// encodings, with and without a maximum length of tokens.
+//
+// usage: largetest FILE...
+
+#include "../src/large.h"
+#include <locale.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <wchar.h>
+
+#define TEXT_LEN (1 << 16)
+#define BATCH 1024
+
+static const int windows[] = { 100, 4096, 65536 };
+static const int maxlens[] = { 0, 64 };
+
+typedef struct
+{
+  int64_t start;
+  uint32_t len;
+  uint8_t type, flags, shape;
+  uint64_t hash, lhash;
+} token;
+
+static jchar text[TEXT_LEN];
+static char text8[4 * TEXT_LEN];
+
+// the tokens of a batch, and their normalized forms
+static uint32_t start[BATCH], len[BATCH], norm_start[BATCH], norm_len[BATCH];
+static uint8_t type[BATCH], flags[BATCH], shape[BATCH];
+static uint64_t hash[BATCH], lhash[BATCH];
+static jchar arena[2 * BATCH * 64];
+
+// the text, in both encodings
+static int
+read_text(int argc, char** argv, int* len8)
+{
+  mbstate_t state = { 0 };
+  int n = 0;
+
+  *len8 = 0;
+  for (int i = 1; i < argc && n < TEXT_LEN; i++) {
+    FILE* f = fopen(argv[i], "r");
+    wint_t c;
+
+    if (!f) {
+      fprintf(stderr, "largetest: cannot read %s.\n", argv[i]);
+      return -1;
+    }
+    while (n < TEXT_LEN && (c = fgetwc(f)) != WEOF) {
+      text[n++] = (jchar)c;
+      *len8 += (int)wcrtomb(text8 + *len8, (wchar_t)c, &state);
+    }
+    fclose(f);
+  }
+
+  return n;
+}
+
+// all the tokens, and the normalized forms (in `norms`, `*size` code
+// units): with a parser of the whole text (window 0), or by windows
+static int64_t
+collect(int utf8, int window, int maxlen, int n, int n8, token* tokens,
+        char* norms, size_t* size)
+{
+  TTokens out = { start, len, type, flags, hash, lhash, shape };
+  TNorms nm = {
+    NORM_LOWER | NORM_UNACCENT, arena, 2 * BATCH * 64, 0, norm_start,
+    norm_len
+  };
+  size_t unit = utf8 ? 1 : sizeof(jchar);
+  TLarge lt;
+  TParser whole;
+  TParser* pst = &whole;
+  int64_t k = 0;
+
+  if (window) {
+    if (utf8)
+      init_large_utf8(&lt, text8, n8);
+    else
+      init_large(&lt, text, n);
+    lt.window = window;
+    pst = &lt.pst;
+  } else if (utf8)
+    init_parser_utf8(&whole, text8, n8);
+  else
+    init_parser(&whole, text, n);
+  pst->maxlen = maxlen;
+
+  *size = 0;
+  for (;;) {
+    int m;
+
+    nm.used = 0;
+    if (window)
+      m = get_large_tokens(&lt, &out, &nm, BATCH);
+    else
+      m = utf8 ? get_tokens_norm_utf8(pst, &out, &nm, BATCH)
+               : get_tokens_norm(pst, &out, &nm, BATCH);
+    if (!m)
+      break;
+
+    for (int i = 0; i < m; i++) {
+      token* t = &tokens[k++];
+
+      t->start = (window ? lt.base : 0) + start[i];
+      t->len = len[i];
+      t->type = type[i];
+      t->flags = flags[i];
+      t->shape = shape[i];
+      t->hash = hash[i];
+      t->lhash = lhash[i];
+    }
+    memcpy(norms + *size, arena, unit * (size_t)nm.used);
+    *size += unit * (size_t)nm.used;
+  }
+
+  return k;
+}
+
+static int
+same(const token* a, const token* b, int64_t n)
+{
+  for (int64_t i = 0; i < n; i++) {
+    if (a[i].start != b[i].start || a[i].len != b[i].len ||
+        a[i].type != b[i].type || a[i].flags != b[i].flags ||
+        a[i].shape != b[i].shape || a[i].hash != b[i].hash ||
+        a[i].lhash != b[i].lhash)
+      return 0;
+  }
+
+  return 1;
+}
+
+int
+main(int argc, char** argv)
+{
+  size_t norms_size = 2 * sizeof(text8);
+  token* whole = malloc(sizeof(token) * sizeof(text8));
+  token* large = malloc(sizeof(token) * sizeof(text8));
+  char* whole_norms = malloc(norms_size);
+  char* large_norms = malloc(norms_size);
+  int n, n8, failures = 0;
+
+  setlocale(LC_ALL, "C.UTF-8");
+  if (argc < 2) {
+    fputs("usage: largetest FILE...\n", stderr);
+    return 1;
+  }
+  if (!whole || !large || !whole_norms || !large_norms) {
+    fputs("(memory error.)", stderr);
+    return 1;
+  }
+  if ((n = read_text(argc, argv, &n8)) < 0)
+    return 1;
+
+  for (int utf8 = 0; utf8 < 2; utf8++) {
+    for (size_t m = 0; m < sizeof(maxlens) / sizeof(maxlens[0]); m++) {
+      size_t size_a, size_b;
+      int64_t a =
+        collect(utf8, 0, maxlens[m], n, n8, whole, whole_norms, &size_a);
+
+      for (size_t w = 0; w < sizeof(windows) / sizeof(windows[0]); w++) {
+        int64_t b = collect(utf8, windows[w], maxlens[m], n, n8, large,
+                            large_norms, &size_b);
+
+        if (a != b || !same(whole, large, a) || size_a != size_b ||
+            memcmp(whole_norms, large_norms, size_a)) {
+          fprintf(stderr,
+                  "largetest: %s, maxlen %d, window %d: the tokens differ "
+                  "(%lld tokens, %lld by windows)\n",
+                  utf8 ? "utf-8" : "code points", maxlens[m], windows[w],
+                  (long long)a, (long long)b);
+          failures++;
+        }
+      }
+    }
+  }
+
+  free(whole);
+  free(large);
+  free(whole_norms);
+  free(large_norms);
+
+  if (failures)
+    return 1;
+  printf("largetest: %d characters, same tokens\n", n);
+
+  return 0;
+}
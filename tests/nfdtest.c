@@ -0,0 +1,278 @@
+// a decomposed text (nfd: 'e' + U+0301) must give the same tokens as
+// the composed text (start and length in the composed text, type and
+// flags: with both engines), and the same index terms. a combining mark
+// never starts a word, and the variation selectors and the enclosing
+// marks of the emojis are not in the words.
+//
+// usage: nfdtest [FILE...] (the lines of the files are tested too, but
+// the faces of 'ô', "ô.ô", that are not emoticons in nfd)
+
+#include "../src/chartab.h"
+#include "../src/terms.h"
+#include "../src/util.h"
+#include <locale.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <wchar.h>
+
+#define MAX_LINE 4096
+
+// the texts in nfc, decomposed by the test
+static const char* const texts[] = {
+  "il était une fois à l'été",
+  "être, àêéôî, premier.ère, pensé-je, tél. 01",
+  "Ça Été ÉTÉ Œuvre naïve, Noël à Saint-Étienne",
+  "enseignant·e·s élu·e·s élèves",
+  "=) :-) ^^ «égalité» @élise #été",
+  "http://é.fr 1ère 2ème l’été qu’à",
+};
+
+// the words of the emojis (and of the lone marks)
+static const char* const emoji_cases[][2] = {
+  { "❤️merci 1️⃣ x", "merci x" },
+  { "#️⃣ ☺︎ ok 👍🏽 bien", "ok bien" },
+  { "x ́abc", "x abc" },
+  { "é ́ ̀e", "é e" },
+};
+
+// the decomposition of the letters U+00C0-U+017F: (base, mark)
+static jchar decomposition[0x180][2];
+
+static int failures = 0;
+
+static void
+init_decomposition(void)
+{
+  for (jchar mark = 0x300; mark < 0x370; mark++) {
+    for (jchar base = 'A'; base <= 'z'; base++) {
+      jchar c = jch_compose(base, mark);
+
+      if (c >= 0xc0 && c < 0x180 && !decomposition[c][0]) {
+        decomposition[c][0] = base;
+        decomposition[c][1] = mark;
+      }
+    }
+  }
+}
+
+// the text in nfd, and the offset of each of its characters in the text
+static int
+decompose(const jchar* str, int len, jchar* nfd, int* offset)
+{
+  int n = 0;
+
+  for (int i = 0; i < len; i++) {
+    jchar c = str[i];
+
+    if (c >= 0xc0 && c < 0x180 && decomposition[c][0]) {
+      offset[n] = i;
+      nfd[n++] = decomposition[c][0];
+      c = decomposition[c][1];
+    }
+    offset[n] = i;
+    nfd[n++] = c;
+  }
+  offset[n] = len;
+
+  return n;
+}
+
+static int
+has_face(const jchar* str, int len)
+{
+  for (int i = 0; i + 1 < len; i++) {
+    if ((str[i] == L'ô' || str[i] == L'Ô') &&
+        (str[i + 1] == '.' || str[i + 1] == '_'))
+      return 1;
+  }
+
+  return 0;
+}
+
+static int
+is_word(int type)
+{
+  return type == TS_WORD || type == TS_COMPOUND || type == TS_ABBREV;
+}
+
+// the tokens of a text: returns -1 if a word starts with a mark
+static int
+tokenize(jchar* str, int len, int engine, TTokens* out)
+{
+  TParser pst;
+  int n;
+
+  init_parser(&pst, str, len);
+  pst.engine = engine;
+  n = get_tokens(&pst, out, MAX_LINE);
+  for (int i = 0; i < n; i++) {
+    if (is_word(out->type[i]) && (jch_ctype(str[out->start[i]]) & JCH_MARK))
+      return -1;
+  }
+
+  return n;
+}
+
+// the index terms of a text, separated by spaces
+static void
+terms(jchar* str, int len, jchar* out, int* size)
+{
+  static jchar buf[4 * MAX_LINE];
+  static uint32_t start[MAX_LINE], tlen[MAX_LINE];
+  static uint32_t norm_start[MAX_LINE], norm_len[MAX_LINE];
+  static uint8_t type[MAX_LINE], flags[MAX_LINE];
+  TTokens tokens = { start, tlen, type, flags, NULL, NULL, NULL };
+  TNorms norms = { 0, buf, 4 * MAX_LINE, 0, norm_start, norm_len };
+  TParser pst;
+  int n;
+
+  init_parser(&pst, str, len);
+  *size = 0;
+  while ((n = get_terms(&pst, &tokens, &norms, MAX_LINE))) {
+    for (int i = 0; i < n; i++) {
+      memcpy(&out[*size], &buf[norm_start[i]],
+             sizeof(jchar) * norm_len[i]);
+      *size += (int)norm_len[i];
+      out[(*size)++] = ' ';
+    }
+    norms.used = 0;
+  }
+}
+
+static void
+check(const char* name, jchar* str, int len)
+{
+  static uint32_t start[2][MAX_LINE], tlen[2][MAX_LINE];
+  static uint8_t type[2][MAX_LINE], flags[2][MAX_LINE];
+  static jchar nfd[2 * MAX_LINE], terms_nfc[4 * MAX_LINE],
+    terms_nfd[4 * MAX_LINE];
+  static int offset[2 * MAX_LINE + 1];
+  TTokens out[2];
+  int n[2], size[2];
+  int nfd_len = decompose(str, len, nfd, offset);
+
+  for (int engine = ENGINE_SWITCH; engine <= ENGINE_DFA; engine++) {
+    for (int k = 0; k < 2; k++)
+      out[k] = (TTokens){ start[k], tlen[k], type[k], flags[k], 0, 0, 0 };
+    n[0] = tokenize(str, len, engine, &out[0]);
+    n[1] = tokenize(nfd, nfd_len, engine, &out[1]);
+    if (n[0] < 0 || n[1] < 0) {
+      fprintf(stderr, "nfdtest: %s: a word starts with a mark (%s)\n", name,
+              engine == ENGINE_DFA ? "dfa" : "switch");
+      failures++;
+      continue;
+    }
+
+    for (int i = 0; i < n[1]; i++) {
+      int end = (int)(start[1][i] + tlen[1][i]);
+
+      start[1][i] = (uint32_t)offset[start[1][i]];
+      tlen[1][i] = (uint32_t)offset[end] - start[1][i];
+    }
+
+    if (n[0] != n[1] ||
+        memcmp(start[0], start[1], sizeof(uint32_t) * (size_t)n[0]) ||
+        memcmp(tlen[0], tlen[1], sizeof(uint32_t) * (size_t)n[0]) ||
+        memcmp(type[0], type[1], (size_t)n[0]) ||
+        memcmp(flags[0], flags[1], (size_t)n[0])) {
+      fprintf(stderr, "nfdtest: %s: the nfd tokens differ (%s)\n", name,
+              engine == ENGINE_DFA ? "dfa" : "switch");
+      failures++;
+    }
+  }
+
+  terms(str, len, terms_nfc, &size[0]);
+  terms(nfd, nfd_len, terms_nfd, &size[1]);
+  if (size[0] != size[1] ||
+      memcmp(terms_nfc, terms_nfd, sizeof(jchar) * (size_t)size[0])) {
+    fprintf(stderr, "nfdtest: %s: the nfd terms differ\n", name);
+    failures++;
+  }
+}
+
+// the words of a text, separated by spaces
+static void
+words(jchar* str, int len, char* out, size_t size)
+{
+  static uint32_t start[MAX_LINE], tlen[MAX_LINE];
+  static uint8_t type[MAX_LINE], flags[MAX_LINE];
+  TTokens tokens = { start, tlen, type, flags, NULL, NULL, NULL };
+  size_t k = 0;
+  int n = tokenize(str, len, ENGINE_SWITCH, &tokens);
+
+  for (int i = 0; i < n; i++) {
+    if (!is_word(type[i]))
+      continue;
+    for (uint32_t j = 0; j < tlen[i] && k + 5 < size; j++) {
+      int w = wctomb(out + k, (wchar_t)str[start[i] + j]);
+      if (w > 0)
+        k += (size_t)w;
+    }
+    out[k++] = ' ';
+  }
+  if (k)
+    k--;
+  out[k] = '\0';
+}
+
+int
+main(int argc, char** argv)
+{
+  static wchar_t line[MAX_LINE];
+  static jchar str[MAX_LINE];
+  char out[1024];
+  int n = 0;
+
+  setlocale(LC_ALL, "C.UTF-8");
+  init_decomposition();
+
+  for (size_t i = 0; i < sizeof(texts) / sizeof(texts[0]); i++) {
+    int len = (int)mbstowcs(line, texts[i], MAX_LINE);
+
+    for (int k = 0; k < len; k++)
+      str[k] = (jchar)line[k];
+    check(texts[i], str, len);
+    n++;
+  }
+
+  for (size_t i = 0; i < sizeof(emoji_cases) / sizeof(emoji_cases[0]); i++) {
+    int len = (int)mbstowcs(line, emoji_cases[i][0], MAX_LINE);
+
+    for (int k = 0; k < len; k++)
+      str[k] = (jchar)line[k];
+    check(emoji_cases[i][0], str, len);
+    words(str, len, out, sizeof(out));
+    if (strcmp(out, emoji_cases[i][1])) {
+      fprintf(stderr, "nfdtest: \"%s\": the words are \"%s\", not \"%s\"\n",
+              emoji_cases[i][0], out, emoji_cases[i][1]);
+      failures++;
+    }
+    n++;
+  }
+
+  for (int i = 1; i < argc; i++) {
+    FILE* f = fopen(argv[i], "r");
+
+    if (!f) {
+      fprintf(stderr, "nfdtest: cannot read %s.\n", argv[i]);
+      return 1;
+    }
+    while (fgetws(line, MAX_LINE, f)) {
+      int len = (int)wcslen(line);
+
+      for (int k = 0; k < len; k++)
+        str[k] = (jchar)line[k];
+      if (!has_face(str, len))
+        check(argv[i], str, len);
+      n++;
+    }
+    fclose(f);
+  }
+
+  if (failures)
+    return 1;
+  printf("nfdtest: %d texts, same tokens and terms\n", n);
+
+  return 0;
+}
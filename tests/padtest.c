@@ -0,0 +1,167 @@
+// a padded string (pst->padded, JUSQUCI_PAD '\0' after its end) must
+// give the same tokens as the same string without the padding (start,
+// length, type, flags, hashes, shapes and normalized forms): the lines
+// of the files, and random short texts (that end in the middle of a
+// token), in both encodings, with and without a maximum length.
+//
+// usage: padtest [FILE...]
+
+#include "../src/parser.h"
+#include <locale.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <wchar.h>
+
+#define MAX_LINE 4096
+#define N_RANDOM 100000
+
+// the characters of the random texts: the starts of the recognizers,
+// spaces, controls, a combining mark, an emoji, and '\0'
+static const jchar alphabet[] = {
+  'a', 'b', 'X', 'h', 'w', 't', 'p', ':', '/', '.', '-', '\'', L'’',
+  L'·', '(', ')', '[', ']', '@', '#', '1', '2', ',', '!', '?', ' ',
+  ' ', '\n', '\t', 1, L'é', 0x1f600, '=', '>', '^', 'o', 'v', 'e', 's',
+  'r', 'i', '_', '~', '+', L'°', 0xad, 0x301, '&', '%', '$', 0,
+};
+
+#define N_ALPHABET (int)(sizeof(alphabet) / sizeof(alphabet[0]))
+
+typedef struct
+{
+  uint32_t start[MAX_LINE], len[MAX_LINE], norm_start[MAX_LINE],
+    norm_len[MAX_LINE];
+  uint8_t type[MAX_LINE], flags[MAX_LINE], shape[MAX_LINE];
+  uint64_t hash[MAX_LINE], lhash[MAX_LINE];
+  jchar arena[2 * MAX_LINE];
+  int n;
+  int used;
+} result;
+
+static result results[2];
+
+static void
+tokenize(void* text, int len, int utf8, int padded, int maxlen,
+         result* r)
+{
+  TTokens out = { r->start, r->len, r->type, r->flags,
+                  r->hash, r->lhash, r->shape };
+  TNorms norms = { NORM_LOWER | NORM_UNACCENT, r->arena, 2 * MAX_LINE, 0,
+                   r->norm_start, r->norm_len };
+  TParser pst;
+
+  if (utf8)
+    init_parser_utf8(&pst, text, len);
+  else
+    init_parser(&pst, text, len);
+  pst.padded = padded;
+  pst.maxlen = maxlen;
+
+  r->n = utf8 ? get_tokens_norm_utf8(&pst, &out, &norms, MAX_LINE)
+              : get_tokens_norm(&pst, &out, &norms, MAX_LINE);
+  r->used = norms.used;
+}
+
+// the text is followed by its padding
+static int
+compare(void* text, int len, int utf8, int maxlen)
+{
+  result* a = &results[0];
+  result* b = &results[1];
+  size_t n, unit = utf8 ? 1 : sizeof(jchar);
+
+  tokenize(text, len, utf8, 0, maxlen, a);
+  tokenize(text, len, utf8, 1, maxlen, b);
+  n = (size_t)a->n;
+
+  return a->n == b->n && a->used == b->used &&
+         !memcmp(a->start, b->start, sizeof(uint32_t) * n) &&
+         !memcmp(a->len, b->len, sizeof(uint32_t) * n) &&
+         !memcmp(a->type, b->type, n) && !memcmp(a->flags, b->flags, n) &&
+         !memcmp(a->shape, b->shape, n) &&
+         !memcmp(a->hash, b->hash, sizeof(uint64_t) * n) &&
+         !memcmp(a->lhash, b->lhash, sizeof(uint64_t) * n) &&
+         !memcmp(a->norm_start, b->norm_start, sizeof(uint32_t) * n) &&
+         !memcmp(a->norm_len, b->norm_len, sizeof(uint32_t) * n) &&
+         !memcmp(a->arena, b->arena, unit * (size_t)a->used);
+}
+
+// a text, in both encodings (with a truncated utf-8 sequence at the
+// end, if `truncated`). returns 1 if the tokens differ.
+static int
+check(const jchar* str, int len, int truncated)
+{
+  static jchar text[MAX_LINE + JUSQUCI_PAD];
+  static char text8[4 * MAX_LINE + JUSQUCI_PAD];
+  mbstate_t state = { 0 };
+  int len8 = 0;
+
+  memcpy(text, str, sizeof(jchar) * (size_t)len);
+  memset(&text[len], 0, sizeof(jchar) * JUSQUCI_PAD);
+  for (int i = 0; i < len; i++) {
+    size_t w = wcrtomb(&text8[len8], (wchar_t)str[i], &state);
+    if (w != (size_t)-1)
+      len8 += (int)w;
+  }
+  if (truncated)
+    text8[len8++] = (char)0xc3;
+  memset(&text8[len8], 0, JUSQUCI_PAD);
+
+  for (int maxlen = 0; maxlen <= 5; maxlen += 5) {
+    if (!compare(text, len, 0, maxlen) || !compare(text8, len8, 1, maxlen))
+      return 1;
+  }
+
+  return 0;
+}
+
+int
+main(int argc, char** argv)
+{
+  static wchar_t line[MAX_LINE];
+  static jchar str[MAX_LINE];
+  int n = 0, failures = 0;
+
+  setlocale(LC_ALL, "C.UTF-8");
+
+  for (int i = 1; i < argc; i++) {
+    FILE* f = fopen(argv[i], "r");
+
+    if (!f) {
+      fprintf(stderr, "padtest: cannot read %s.\n", argv[i]);
+      return 1;
+    }
+    for (int lineno = 1; fgetws(line, MAX_LINE, f); lineno++) {
+      int len = (int)wcslen(line);
+
+      for (int k = 0; k < len; k++)
+        str[k] = (jchar)line[k];
+      if (check(str, len, 0)) {
+        fprintf(stderr, "padtest: %s, line %d: the tokens differ\n",
+                argv[i], lineno);
+        failures++;
+      }
+      n++;
+    }
+    fclose(f);
+  }
+
+  srand(7);
+  for (int k = 0; k < N_RANDOM; k++) {
+    int len = rand() % 40;
+
+    for (int i = 0; i < len; i++)
+      str[i] = alphabet[rand() % N_ALPHABET];
+    if (check(str, len, k % 5 == 0)) {
+      fprintf(stderr, "padtest: random text %d: the tokens differ\n", k);
+      failures++;
+    }
+    n++;
+  }
+
+  if (failures)
+    return 1;
+  printf("padtest: %d texts, same tokens\n", n);
+
+  return 0;
+}
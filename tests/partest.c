@@ -0,0 +1,140 @@
+// get_tokens_parallel must give the same tokens as get_tokens (start,
+// length, type and flags), with all the types and with some of them
+// filtered out: the text (the files, repeated) is longer than several
+// segments (PARALLEL_MIN_SEGMENT).
+//
+// usage: partest FILE...
+
+#include "../src/parallel.h"
+#include "../src/terms.h"
+#include <locale.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <wchar.h>
+
+#define TEXT_LEN (8 * PARALLEL_MIN_SEGMENT)
+
+static const unsigned int masks[] = {
+  TYPES_ALL,
+  TYPES_ALL & ~TYPE_BIT(TS_SPACE),
+  TYPES_ALL & ~(TYPE_BIT(TS_SPACE) | TYPE_BIT(TS_PUNCTSTRONG) |
+                TYPE_BIT(TS_NEWLINE)),
+  TERM_TYPES,
+};
+
+static const int threads[] = { 2, 3, 8 };
+
+// read the files, again and again, until the text is long enough
+static int
+read_text(jchar* text, int argc, char** argv)
+{
+  int len = 0;
+
+  while (len < TEXT_LEN) {
+    for (int i = 1; i < argc && len < TEXT_LEN; i++) {
+      FILE* f = fopen(argv[i], "r");
+      wint_t c;
+
+      if (!f) {
+        fprintf(stderr, "partest: cannot read %s.\n", argv[i]);
+        return -1;
+      }
+      while (len < TEXT_LEN && (c = fgetwc(f)) != WEOF)
+        text[len++] = (jchar)c;
+      fclose(f);
+    }
+  }
+  text[len] = 0;
+
+  return len;
+}
+
+static int
+alloc_tokens(TTokens* t, int capacity)
+{
+  t->start = malloc(sizeof(uint32_t) * (size_t)capacity);
+  t->len = malloc(sizeof(uint32_t) * (size_t)capacity);
+  t->type = malloc((size_t)capacity);
+  t->flags = malloc((size_t)capacity);
+  t->hash = NULL;
+  t->lhash = NULL;
+  t->shape = NULL;
+
+  return (t->start && t->len && t->type && t->flags) ? 0 : -1;
+}
+
+static void
+free_tokens(TTokens* t)
+{
+  free(t->start);
+  free(t->len);
+  free(t->type);
+  free(t->flags);
+}
+
+// the index of the first token that is not the same, or -1
+static int
+compare(const TTokens* a, int na, const TTokens* b, int nb)
+{
+  for (int i = 0; i < na && i < nb; i++) {
+    if (a->start[i] != b->start[i] || a->len[i] != b->len[i] ||
+        a->type[i] != b->type[i] || a->flags[i] != b->flags[i])
+      return i;
+  }
+
+  return (na == nb) ? -1 : (na < nb ? na : nb);
+}
+
+int
+main(int argc, char** argv)
+{
+  jchar* text = malloc(sizeof(jchar) * (TEXT_LEN + 1));
+  TTokens seq, par;
+  TParser pst;
+  int len, status = 0;
+
+  setlocale(LC_ALL, "C.UTF-8");
+  if (argc < 2) {
+    fputs("usage: partest FILE...\n", stderr);
+    return 1;
+  }
+  if (!text || alloc_tokens(&seq, TEXT_LEN) ||
+      alloc_tokens(&par, TEXT_LEN)) {
+    fputs("(memory error.)", stderr);
+    return 1;
+  }
+  if ((len = read_text(text, argc, argv)) < 0)
+    return 1;
+
+  for (size_t m = 0; m < sizeof(masks) / sizeof(masks[0]); m++) {
+    int n_seq, n_par, diff;
+
+    init_parser(&pst, text, len);
+    pst.types = masks[m];
+    n_seq = get_tokens(&pst, &seq, len);
+
+    for (size_t t = 0; t < sizeof(threads) / sizeof(threads[0]); t++) {
+      init_parser(&pst, text, len);
+      pst.types = masks[m];
+      n_par = get_tokens_parallel(&pst, &par, len, threads[t]);
+
+      if ((diff = compare(&seq, n_seq, &par, n_par)) >= 0) {
+        fprintf(stderr,
+                "partest: types %#x, %d threads: token %d differs "
+                "(%d tokens, %d in parallel)\n",
+                masks[m], threads[t], diff, n_seq, n_par);
+        status = 1;
+      }
+    }
+  }
+
+  if (!status)
+    printf("partest: %d characters, same tokens\n", len);
+
+  free_tokens(&seq);
+  free_tokens(&par);
+  free(text);
+
+  return status;
+}
@@ -0,0 +1,86 @@
+// the index terms (get_terms) of some texts: the forms of a word (the
+// plural, the feminine, the inclusive forms) must give the same term.
+//
+// usage: termtest
+
+#include "../src/terms.h"
+#include <locale.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <wchar.h>
+
+#define MAX_TOKENS 256
+
+static const char* const cases[][2] = {
+  // the inclusive forms: the masculine form
+  { "enseignant·e·s enseignant·e enseignants enseignant",
+    "enseignant enseignant enseignant enseignant" },
+  { "ami.e.s ami.e ami", "ami ami ami" },
+  { "auteur·rice auteur·rice·s auteur.rice.s auteurs autrice",
+    "auteu auteu auteu auteu auteu" },
+  { "chanteur·euse·s chanteurs", "chant chant" },
+  // the stopwords, the elisions, the inversions, the abbreviations
+  { "il était une fois à Paris", "foi pari" },
+  { "l'homme qu'il voit dit-il", "home voit dit" },
+  { "voir p. 12 et fig. 3", "voir p fig" },
+};
+
+// the terms of a text, separated by spaces
+static void
+terms(const char* text, char* out, size_t size)
+{
+  static jchar str[MAX_TOKENS], buf[2 * MAX_TOKENS];
+  static uint32_t start[MAX_TOKENS], len[MAX_TOKENS];
+  static uint32_t norm_start[MAX_TOKENS], norm_len[MAX_TOKENS];
+  static uint8_t type[MAX_TOKENS], flags[MAX_TOKENS];
+  TTokens tokens = { start, len, type, flags, NULL, NULL, NULL };
+  TNorms norms = { 0, buf, 2 * MAX_TOKENS, 0, norm_start, norm_len };
+  TParser pst;
+  size_t k = 0;
+  int n;
+
+  n = (int)mbstowcs((wchar_t*)str, text, MAX_TOKENS);
+  init_parser(&pst, str, n);
+  out[0] = '\0';
+
+  while ((n = get_terms(&pst, &tokens, &norms, MAX_TOKENS))) {
+    for (int i = 0; i < n; i++) {
+      for (uint32_t j = 0; j < norm_len[i] && k + 5 < size; j++) {
+        int w = wctomb(out + k, (wchar_t)buf[norm_start[i] + j]);
+        if (w > 0)
+          k += (size_t)w;
+      }
+      out[k++] = ' ';
+    }
+    norms.used = 0;
+  }
+  if (k)
+    k--;
+  out[k] = '\0';
+}
+
+int
+main(void)
+{
+  char out[1024];
+  int failures = 0;
+
+  setlocale(LC_ALL, "C.UTF-8");
+
+  for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+    terms(cases[i][0], out, sizeof(out));
+    if (strcmp(out, cases[i][1])) {
+      fprintf(stderr, "termtest: \"%s\": \"%s\", not \"%s\"\n", cases[i][0],
+              out, cases[i][1]);
+      failures++;
+    }
+  }
+
+  if (failures)
+    return 1;
+  printf("termtest: %d texts, same terms\n",
+         (int)(sizeof(cases) / sizeof(cases[0])));
+
+  return 0;
+}
@@ -0,0 +1,149 @@
+// the utf-8 parser must give the same tokens as the parser of code
+// points (and both engines the same), without reading the string after
+// its end: each text is copied in a buffer of its exact length, without
+// a '\0' (built with -fsanitize=address, see `make utf8test`).
+//
+// usage: utf8test [FILE...] (the lines of the files are tested too)
+
+#include "../src/parser.h"
+#include <locale.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <wchar.h>
+
+#define MAX_LINE 65536
+
+// texts that end in the middle of a recognizer
+static const char* const texts[] = {
+  "a =p", "=)", "a =D", "x =]", "=", "a ==", "=>", "a ==>",
+  ":-)", "a :-", ";)", "^^", "^", "o.o", "ô.ô", "O_", "<3", "<",
+  "humaine.e.s", "humain·e", "entends-les", "entends-", "1er", "1ère",
+  "p.", "M.", "12,5", "12,", "3/4", "http://", "https://ex.fr",
+  "@becker1982", "@", "#tag", "...", "?!", "«", "é", "e\xcc\x81",
+  "\xc3", "\xe2\x82", "\xf0\x9f\x98", "\xf0\x9f\x98\x80", "a\xff",
+};
+
+static int failures = 0;
+
+// the bytes of a text (invalid or not), as the utf-8 parser reads them:
+// code points, and the offset of each byte in the code points
+static int
+decode(const char* s, int size, jchar* str, int* offset)
+{
+  mbstate_t state;
+  int len = 0;
+
+  for (int i = 0; i < size;) {
+    wchar_t c;
+    size_t n;
+
+    memset(&state, 0, sizeof(state));
+    n = mbrtowc(&c, s + i, (size_t)(size - i), &state);
+    if (n == 0 || n > 4) {
+      c = 0xfffd;
+      n = 1;
+    }
+    for (size_t k = 0; k < n; k++)
+      offset[i + (int)k] = len;
+    str[len++] = (jchar)c;
+    i += (int)n;
+  }
+  offset[size] = len;
+
+  return len;
+}
+
+static void
+check(const char* name, const char* bytes, int size)
+{
+  static uint32_t start[2][MAX_LINE], tlen[2][MAX_LINE];
+  static uint8_t type[2][MAX_LINE], flags[2][MAX_LINE];
+  static jchar text[MAX_LINE];
+  static int offset[MAX_LINE + 1];
+  TTokens out[2];
+  TParser pst;
+  int n[2], len;
+  jchar* str;
+  char* s;
+
+  len = decode(bytes, size, text, offset);
+
+  // the exact buffers
+  str = malloc(sizeof(jchar) * (size_t)(len ? len : 1));
+  s = malloc((size_t)(size ? size : 1));
+  memcpy(str, text, sizeof(jchar) * (size_t)len);
+  memcpy(s, bytes, (size_t)size);
+
+  for (int engine = ENGINE_SWITCH; engine <= ENGINE_DFA; engine++) {
+    for (int k = 0; k < 2; k++) {
+      out[k] = (TTokens){ start[k], tlen[k], type[k], flags[k], 0, 0, 0 };
+      if (k)
+        init_parser_utf8(&pst, s, size);
+      else
+        init_parser(&pst, str, len);
+      pst.engine = engine;
+      n[k] = k ? get_tokens_utf8(&pst, &out[k], MAX_LINE)
+               : get_tokens(&pst, &out[k], MAX_LINE);
+    }
+
+    for (int i = 0; i < n[1]; i++) {
+      int end = (int)(start[1][i] + tlen[1][i]);
+
+      start[1][i] = (uint32_t)offset[start[1][i]];
+      tlen[1][i] = (uint32_t)offset[end] - start[1][i];
+    }
+
+    if (n[0] != n[1] ||
+        memcmp(start[0], start[1], sizeof(uint32_t) * (size_t)n[0]) ||
+        memcmp(tlen[0], tlen[1], sizeof(uint32_t) * (size_t)n[0]) ||
+        memcmp(type[0], type[1], (size_t)n[0]) ||
+        memcmp(flags[0], flags[1], (size_t)n[0])) {
+      fprintf(stderr, "utf8test: %s: the utf-8 tokens differ (%s)\n", name,
+              engine == ENGINE_DFA ? "dfa" : "switch");
+      failures++;
+    }
+  }
+
+  free(str);
+  free(s);
+}
+
+int
+main(int argc, char** argv)
+{
+  static char line[MAX_LINE];
+  int n = 0;
+
+  setlocale(LC_ALL, "C.UTF-8");
+
+  for (size_t i = 0; i < sizeof(texts) / sizeof(texts[0]); i++) {
+    check(texts[i], texts[i], (int)strlen(texts[i]));
+    n++;
+  }
+
+  for (int i = 1; i < argc; i++) {
+    FILE* f = fopen(argv[i], "r");
+
+    if (!f) {
+      fprintf(stderr, "utf8test: cannot read %s.\n", argv[i]);
+      return 1;
+    }
+    // with and without the newline
+    while (fgets(line, MAX_LINE, f)) {
+      int size = (int)strlen(line);
+
+      check(argv[i], line, size);
+      if (size > 1 && line[size - 1] == '\n')
+        check(argv[i], line, size - 1);
+      n++;
+    }
+    fclose(f);
+  }
+
+  if (failures)
+    return 1;
+  printf("utf8test: %d texts, same tokens\n", n);
+
+  return 0;
+}
@@ -0,0 +1,207 @@
+/* mkchartab -- generate the character tables (src/chartab.c).
+ *
+ * the tables are built once, from the libc's "C.UTF-8" locale, so
+ * that the tokenizer never calls `iswalpha`, `towlower`, etc. at
+ * runtime: the result is the same whatever the locale of the
+ * process (postgresql backend, python, command line).
+ *
+ *    ./mkchartab > ../src/chartab.c
+ *
+ * the letters without diacritics (`jch_fold`) are the ones of the
+ * libc's transliteration (iconv, "ASCII//TRANSLIT"), when it gives
+ * one or two ascii letters: é -> e, œ -> oe, ß -> ss.
+ *
+ * the combining marks (the class "combining" of the libc, but the ones
+ * that are already letters) are letters too (JCH_MARK): in a
+ * decomposed text (nfd), "e" + U+0301 is a single word. the variation
+ * selectors and the enclosing marks are not: they follow emojis and
+ * digits ("❤️", "1️⃣"), not letters.
+ */
+
+#include "../src/chartab.h"
+#include <ctype.h>
+#include <iconv.h>
+#include <locale.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <wctype.h>
+
+#define N_BLOCKS (JCH_MAX >> 8)
+
+static unsigned char ctype[JCH_MAX];
+static int lower[JCH_MAX];
+static unsigned short fold[JCH_MAX];
+
+/* deduplicated blocks of 256 code points */
+static int ctype_index[N_BLOCKS];
+static int lower_index[N_BLOCKS];
+static int fold_index[N_BLOCKS];
+static int ctype_blocks[N_BLOCKS];
+static int lower_blocks[N_BLOCKS];
+static int fold_blocks[N_BLOCKS];
+
+/* find identical blocks, so the second level stays small. */
+static int
+dedup(const void* data, size_t size, int* index, int* blocks)
+{
+  const char* p = data;
+  int n = 0;
+  int b, j;
+
+  for (b = 0; b < N_BLOCKS; b++) {
+    for (j = 0; j < n; j++) {
+      if (!memcmp(p + (size_t)blocks[j] * 256 * size,
+                  p + (size_t)b * 256 * size,
+                  256 * size))
+        break;
+    }
+    if (j == n)
+      blocks[n++] = b;
+    index[b] = j;
+  }
+  return n;
+}
+
+static void
+print_index(const char* name, const int* index)
+{
+  printf("const unsigned char %s[JCH_MAX >> 8] = {", name);
+  for (int b = 0; b < N_BLOCKS; b++)
+    printf("%s%d,", (b % 16) ? " " : "\n  ", index[b]);
+  printf("\n};\n\n");
+}
+
+/* the transliteration of a letter: one or two ascii letters, packed
+ * (the first one in the low byte), or 0. */
+static unsigned short
+translit(iconv_t cd, jchar c)
+{
+  char in[4] = { 0 };
+  char out[8] = { 0 };
+  char* pin = in;
+  char* pout = out;
+  size_t n_in;
+  size_t n_out = sizeof(out) - 1;
+
+  /* utf-8 */
+  if (c < 0x800) {
+    in[0] = (char)(0xc0 | c >> 6);
+    in[1] = (char)(0x80 | (c & 0x3f));
+    n_in = 2;
+  } else if (c < 0x10000) {
+    in[0] = (char)(0xe0 | c >> 12);
+    in[1] = (char)(0x80 | (c >> 6 & 0x3f));
+    in[2] = (char)(0x80 | (c & 0x3f));
+    n_in = 3;
+  } else {
+    in[0] = (char)(0xf0 | c >> 18);
+    in[1] = (char)(0x80 | (c >> 12 & 0x3f));
+    in[2] = (char)(0x80 | (c >> 6 & 0x3f));
+    in[3] = (char)(0x80 | (c & 0x3f));
+    n_in = 4;
+  }
+
+  iconv(cd, NULL, NULL, NULL, NULL);
+  if (iconv(cd, &pin, &n_in, &pout, &n_out) == (size_t)-1)
+    return 0;
+
+  if (pout - out == 1 && isalpha((unsigned char)out[0]))
+    return (unsigned short)out[0];
+  if (pout - out == 2 && isalpha((unsigned char)out[0]) &&
+      isalpha((unsigned char)out[1]))
+    return (unsigned short)(out[0] | out[1] << 8);
+
+  return 0;
+}
+
+/* the marks that are not diacritics: the variation selectors, and the
+ * enclosing marks (the circles, the keycap) */
+static int
+is_selector(jchar c)
+{
+  return (c >= 0xfe00 && c <= 0xfe0f) || (c >= 0xe0100 && c <= 0xe01ef) ||
+         (c >= 0x180b && c <= 0x180f) || (c >= 0x20dd && c <= 0x20e0) ||
+         (c >= 0x20e2 && c <= 0x20e4);
+}
+
+int
+main(void)
+{
+  int n_ctype, n_lower, n_fold, b, i;
+
+  if (!setlocale(LC_CTYPE, "C.UTF-8")) {
+    fputs("mkchartab: locale C.UTF-8 not available.\n", stderr);
+    return 1;
+  }
+
+  wctype_t combining = wctype("combining");
+  if (!combining) {
+    fputs("mkchartab: no class of combining marks.\n", stderr);
+    return 1;
+  }
+
+  iconv_t cd = iconv_open("ASCII//TRANSLIT", "UTF-8");
+  if (cd == (iconv_t)-1) {
+    fputs("mkchartab: iconv not available.\n", stderr);
+    return 1;
+  }
+
+  for (jchar c = 0; c < JCH_MAX; c++) {
+    wint_t w = (wint_t)c;
+    ctype[c] = (unsigned char)((iswalpha(w) ? JCH_ALPHA : 0) |
+                               (iswspace(w) ? JCH_SPACE : 0) |
+                               (iswdigit(w) ? JCH_DIGIT : 0) |
+                               (iswcntrl(w) ? JCH_CNTRL : 0) |
+                               (iswupper(w) ? JCH_UPPER : 0) |
+                               (iswlower(w) ? JCH_LOWER : 0));
+    if (iswctype(w, combining) && !iswalpha(w) && !is_selector(c))
+      ctype[c] |= JCH_ALPHA | JCH_MARK;
+    lower[c] = (int)towlower(w) - (int)c;
+    if (c >= 0x80 && iswalpha(w) && (c < 0xd800 || c > 0xdfff))
+      fold[c] = translit(cd, c);
+  }
+  iconv_close(cd);
+
+  n_ctype = dedup(ctype, sizeof(ctype[0]), ctype_index, ctype_blocks);
+  n_lower = dedup(lower, sizeof(lower[0]), lower_index, lower_blocks);
+  n_fold = dedup(fold, sizeof(fold[0]), fold_index, fold_blocks);
+
+  if (n_ctype > 256 || n_lower > 256 || n_fold > 256 || ctype_index[0] ||
+      lower_index[0] || fold_index[0]) {
+    fputs("mkchartab: tables do not fit.\n", stderr);
+    return 1;
+  }
+
+  printf("/* generated by tools/mkchartab.c -- do not edit. */\n\n");
+  printf("#include \"chartab.h\"\n\n");
+
+  print_index("jch_ctype_index", ctype_index);
+  printf("const unsigned char jch_ctype_blocks[%d * 256] = {", n_ctype);
+  for (b = 0; b < n_ctype; b++)
+    for (i = 0; i < 256; i++)
+      printf("%s%d,",
+             (i % 16) ? " " : "\n  ",
+             ctype[(ctype_blocks[b] << 8) | i]);
+  printf("\n};\n\n");
+
+  print_index("jch_lower_index", lower_index);
+  printf("const int jch_lower_blocks[%d * 256] = {", n_lower);
+  for (b = 0; b < n_lower; b++)
+    for (i = 0; i < 256; i++)
+      printf("%s%d,",
+             (i % 8) ? " " : "\n  ",
+             lower[(lower_blocks[b] << 8) | i]);
+  printf("\n};\n\n");
+
+  print_index("jch_fold_index", fold_index);
+  printf("const unsigned short jch_fold_blocks[%d * 256] = {", n_fold);
+  for (b = 0; b < n_fold; b++)
+    for (i = 0; i < 256; i++)
+      printf("%s0x%04x,",
+             (i % 8) ? " " : "\n  ",
+             fold[(fold_blocks[b] << 8) | i]);
+  printf("\n};\n");
+
+  return 0;
+}
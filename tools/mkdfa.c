@@ -0,0 +1,419 @@
+/* mkdfa -- generate the tables of the state machine lexer (src/dfatab.c).
+ *
+ *    ./mkdfa > ../src/dfatab.c
+ *
+ * the transitions follow what `get_token` (src/parser.c) does: when a
+ * case needs more than the current character (the lexicon, or a
+ * lookahead), the transition is D_BAIL and `get_token` parses the
+ * token.
+ */
+
+#include "../src/dfa.h"
+#include <stdio.h>
+
+/* the class of a character of the first block (ascii and latin-1) */
+static int
+char_class(jchar c)
+{
+  switch (c) {
+    case L'\0':
+      return Cl_Nul;
+    case L' ':
+      return Cl_Blank;
+    case L'\n':
+      return Cl_Newline;
+    case L'k':
+      return Cl_K;
+    case L'x':
+      return Cl_X;
+    case L'X':
+      return Cl_XU;
+    case L'h':
+      return Cl_H;
+    case L'w':
+      return Cl_W;
+    case L'W':
+      return Cl_WU;
+    case L't':
+    case L'T':
+      return Cl_T;
+    case L'p':
+    case L'P':
+      return Cl_P;
+    case L'o':
+    case L'v':
+    case L'ô':
+    case L'O':
+    case L'V':
+    case L'Ô':
+      return Cl_O;
+    case L'·':
+      return Cl_Middot;
+    case L'.':
+      return Cl_Dot;
+    case L'!':
+    case L'?':
+      return Cl_Strong;
+    case L':':
+    case L';':
+      return Cl_Colon;
+    case L'=':
+      return Cl_Eq;
+    case L'^':
+      return Cl_Caret;
+    case L'-':
+      return Cl_Hyphen;
+    case L'/':
+    case L'+':
+    case L'*':
+      return Cl_NumSign;
+    case L'(':
+    case L'[':
+      return Cl_Open;
+    case L'{':
+      return Cl_Brace;
+    case L')':
+      return Cl_RParen;
+    case L']':
+    case L'}':
+      return Cl_Close;
+    case L'>':
+      return Cl_Gt;
+    case L'\'':
+      return Cl_Apos;
+    case L'°':
+      return Cl_Degree;
+    case L'@':
+      return Cl_At;
+    case L'_':
+      return Cl_Underscore;
+  }
+
+  if (c >= L'0' && c <= L'9')
+    return Cl_Digit;
+
+  switch (getchtype(c)) {
+    case Ch_Space:
+      return Cl_Space;
+    case Ch_Word:
+      return Cl_Alpha;
+    case Ch_Digit:
+      return Cl_DigitOther;
+    case Ch_Ctrl:
+      return Cl_Cntrl;
+    default:
+      return Cl_Punct;
+  }
+}
+
+static int
+is_letter(int cl)
+{
+  switch (cl) {
+    case Cl_Alpha:
+    case Cl_K:
+    case Cl_X:
+    case Cl_XU:
+    case Cl_H:
+    case Cl_W:
+    case Cl_WU:
+    case Cl_T:
+    case Cl_P:
+    case Cl_O:
+    case Cl_Mark:
+      return 1;
+    default:
+      return 0;
+  }
+}
+
+/* a character of the class, to get its properties. */
+static jchar
+sample(int cl)
+{
+  for (jchar c = 0; c < 0x100; c++) {
+    if (char_class(c) == cl)
+      return c;
+  }
+  return 0;
+}
+
+/* the character type of the class (getchtype) */
+static int
+class_type(int cl)
+{
+  /* the other digits and the marks are not in the first block (see
+   * dfa_class) */
+  if (cl == Cl_DigitOther)
+    return Ch_Digit;
+  if (cl == Cl_Mark)
+    return Ch_Punct;
+  return getchtype(sample(cl));
+}
+
+static int
+class_alpha(int cl)
+{
+  if (cl == Cl_DigitOther)
+    return 0;
+  if (cl == Cl_Mark)
+    return 1;
+  return jch_ctype(sample(cl)) & JCH_ALPHA;
+}
+
+/* parse_word */
+static int
+next_word(int state, int cl)
+{
+  int par = (state == D_WordPar);
+
+  if (state == D_O && (cl == Cl_Dot || cl == Cl_Underscore))
+    return D_BAIL; /* o.o, O_o */
+
+  /* http, www. (case insensitive, but the first letter) */
+  if (state == D_H1 && cl == Cl_T)
+    return D_H2;
+  if (state == D_H2 && cl == Cl_T)
+    return D_H3;
+  if (state == D_H3 && cl == Cl_P)
+    return D_BAIL;
+  if (state == D_W1 && (cl == Cl_W || cl == Cl_WU))
+    return D_W2;
+  if (state == D_W2 && (cl == Cl_W || cl == Cl_WU))
+    return D_W3;
+  if (state == D_W3 && cl == Cl_Dot)
+    return D_BAIL;
+
+  if (is_letter(cl))
+    return par ? D_WordPar : D_Word;
+
+  switch (cl) {
+    case Cl_Open:
+    case Cl_Brace:
+      return D_WordPar;
+    case Cl_RParen:
+    case Cl_Close:
+      return par ? D_Word : D_STOP;
+    case Cl_Hyphen:
+      return par ? D_WordHyphenPar : D_WordHyphen;
+    case Cl_Dot:
+      return D_DOT;
+    case Cl_Middot:
+      return par ? D_WordMidPar : D_WordMid;
+    case Cl_Degree:
+      return D_FAbbrev;
+    case Cl_Apos:
+      return D_FWord;
+    default:
+      return D_STOP;
+  }
+}
+
+static int
+next_state(int state, int cl)
+{
+  switch (state) {
+
+    case D_Start:
+    case D_StartSp:
+      switch (cl) {
+        case Cl_End:
+        case Cl_Nul:
+        case Cl_X:
+        case Cl_XU:
+        case Cl_Eq:
+        case Cl_Caret:
+        case Cl_Open:
+          return D_BAIL;
+        case Cl_Colon:
+          return D_Colon;
+        case Cl_Hyphen:
+          return D_Hyphen;
+        case Cl_H:
+          return D_H1;
+        case Cl_W:
+          return D_W1;
+        case Cl_Blank:
+          return state == D_StartSp ? D_Spaces : D_FSpace;
+        case Cl_Newline:
+          return D_FNewline;
+        case Cl_Middot:
+          return D_FPunct;
+        case Cl_O:
+          return D_O;
+        case Cl_At:
+          return D_Cite;
+      }
+      switch (class_type(cl)) {
+        case Ch_Space:
+          return D_Spaces;
+        case Ch_Word:
+          return D_Word;
+        case Ch_Digit:
+          return D_Num;
+        case Ch_PunctEndSent:
+          return D_Strong;
+        case Ch_Ctrl:
+          return D_Ctrl;
+        default:
+          return D_FPunct;
+      }
+
+    case D_Word:
+    case D_WordPar:
+    case D_O:
+    case D_H1:
+    case D_H2:
+    case D_H3:
+    case D_W1:
+    case D_W2:
+    case D_W3:
+      if (cl == Cl_End)
+        return D_STOP;
+      return next_word(state, cl);
+
+    case D_WordMid:
+    case D_WordMidPar:
+      /* the next character is read without checking the end of the
+       * string: let `get_token` do it. */
+      if (cl == Cl_End)
+        return D_BAIL;
+      if (cl != Cl_Middot && class_alpha(cl))
+        return state == D_WordMidPar ? D_WordPar : D_Word;
+      return D_STOP;
+
+    case D_WordHyphen:
+    case D_WordHyphenPar:
+      /* the same. then, inversions are in the lexicon. */
+      if (cl == Cl_End)
+        return D_BAIL;
+      if (class_alpha(cl))
+        return D_INV;
+      return D_STOP;
+
+    case D_Num:
+    case D_NumSign:
+      switch (cl) {
+        case Cl_Digit:
+          return D_Num;
+        case Cl_RParen:
+        case Cl_Dot:
+        case Cl_Hyphen:
+        case Cl_NumSign:
+        case Cl_Caret:
+        case Cl_Eq:
+        case Cl_K:
+        case Cl_X:
+          return D_NumSign;
+        default:
+          /* ordinals are checked at the end (see dfa.c) */
+          return D_STOP;
+      }
+
+    case D_Strong:
+    case D_Ctrl:
+    case D_Spaces:
+      if (cl == Cl_End)
+        return D_STOP;
+      if (class_type(cl) == dfa_accept[state])
+        return state;
+      return D_STOP;
+
+    case D_Cite:
+      if (cl == Cl_End)
+        return D_STOP;
+      switch (class_type(cl)) {
+        case Ch_Word:
+        case Ch_Digit:
+          return D_Cite;
+      }
+      return (cl == Cl_Underscore || cl == Cl_Mark) ? D_Cite : D_STOP;
+
+    case D_Colon:
+      /* :happy:, :-) or ;) need something else after the ':' */
+      switch (cl) {
+        case Cl_End:
+        case Cl_Blank:
+        case Cl_Newline:
+        case Cl_Space:
+        case Cl_Dot:
+        case Cl_Strong:
+        case Cl_Gt:
+        case Cl_Punct:
+          return D_STOP;
+        default:
+          return D_BAIL;
+      }
+
+    case D_Hyphen:
+      /* --, -> */
+      if (cl == Cl_Hyphen || cl == Cl_Gt)
+        return D_BAIL;
+      return D_STOP;
+
+    default:
+      return D_STOP;
+  }
+}
+
+const int8_t dfa_accept[N_DFA_STATES] = {
+  [D_Start] = -1,
+  [D_StartSp] = -1,
+  [D_Word] = TS_WORD,
+  [D_WordPar] = TS_WORD,
+  [D_WordMid] = -1,
+  [D_WordMidPar] = -1,
+  [D_WordHyphen] = -1,
+  [D_WordHyphenPar] = -1,
+  [D_O] = TS_WORD,
+  [D_H1] = TS_WORD,
+  [D_H2] = TS_WORD,
+  [D_H3] = TS_WORD,
+  [D_W1] = TS_WORD,
+  [D_W2] = TS_WORD,
+  [D_W3] = TS_WORD,
+  [D_Num] = TS_NUMBER,
+  [D_NumSign] = TS_NUMBER,
+  [D_Strong] = Ch_PunctEndSent,
+  [D_Ctrl] = Ch_Ctrl,
+  [D_Spaces] = Ch_Space,
+  [D_Cite] = TS_CITEKEY,
+  [D_Colon] = TS_PUNCTSTRONG,
+  [D_Hyphen] = TS_PUNCT,
+  [D_FWord] = TS_WORD,
+  [D_FAbbrev] = TS_ABBREV,
+  [D_FPunct] = TS_PUNCT,
+  [D_FSpace] = TS_SPACE,
+  [D_FNewline] = TS_NEWLINE,
+};
+
+int
+main(void)
+{
+  printf("/* generated by tools/mkdfa.c -- do not edit. */\n\n");
+  printf("#include \"dfa.h\"\n\n");
+
+  printf("const uint8_t dfa_classes[256] = {\n");
+  for (jchar c = 0; c < 0x100; c++)
+    printf("%s%2d,%s",
+           c % 16 ? " " : "  ",
+           char_class(c),
+           c % 16 == 15 ? "\n" : "");
+  printf("};\n\n");
+
+  printf("const uint8_t dfa_next[N_DFA_STATES][N_DFA_CLASSES] = {\n");
+  for (int s = 0; s < N_DFA_STATES; s++) {
+    printf("  {");
+    for (int cl = 0; cl < N_DFA_CLASSES; cl++)
+      printf("%s0x%02x,", cl % 10 ? " " : "\n    ", next_state(s, cl));
+    printf("\n  },\n");
+  }
+  printf("};\n\n");
+
+  printf("const int8_t dfa_accept[N_DFA_STATES] = {");
+  for (int s = 0; s < N_DFA_STATES; s++)
+    printf(" %d,", dfa_accept[s]);
+  printf(" };\n");
+
+  return 0;
+}
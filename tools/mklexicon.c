@@ -0,0 +1,305 @@
+/* mklexicon -- compile the lists of affixes into a trie (src/lexicon.c).
+ *
+ *    ./mklexicon suffixes.txt inversions.txt abbreviations.txt \
+ *      ordinals.txt > ../src/lexicon.c
+ *    ./mklexicon -o legal.lex suffixes.txt inversions.txt \
+ *      abbreviations.txt,legal.txt ordinals.txt
+ *
+ * the lists are utf-8 text files, one word per line. empty lines and
+ * lines starting with '#' are ignored. words are lowercased. a list
+ * can be made of several files, separated by commas.
+ *
+ * with -o, the lexicon is written into a file that is loaded by
+ * `load_lexicon` (see lexicon.h), instead of the c source of the
+ * lexicon compiled in the library.
+ */
+
+#include "../src/chartab.h"
+#include "../src/lexicon.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define N_LISTS 4
+#define LEN_WORD_MAX 64
+
+/* the trie, while it's built: every node has its own list of
+ * children. */
+typedef struct
+{
+  jchar* c;
+  uint32_t* child;
+  uint16_t n;
+  uint8_t prefix;
+  uint8_t term;
+} tmpnode;
+
+static tmpnode* trie = NULL;
+static uint32_t n_trie = 0;
+
+/* the flattened trie */
+static lexnode* nodes = NULL;
+static lexedge* edges = NULL;
+static uint32_t n_nodes = 0;
+static uint32_t n_edges = 0;
+
+static void*
+xrealloc(void* p, size_t size)
+{
+  p = realloc(p, size);
+  if (!p) {
+    fputs("mklexicon: memory error.\n", stderr);
+    exit(1);
+  }
+  return p;
+}
+
+static uint32_t
+new_node(void)
+{
+  trie = xrealloc(trie, sizeof(tmpnode) * (n_trie + 1));
+  memset(&trie[n_trie], 0, sizeof(tmpnode));
+  return n_trie++;
+}
+
+static void
+add_word(const jchar* word, int len, uint8_t list)
+{
+  uint32_t node = 0;
+
+  for (int i = 0; i < len; i++) {
+    uint32_t next = 0;
+    jchar c = jtowlower(word[i]);
+    tmpnode* t = &trie[node];
+
+    t->prefix |= list;
+    for (int k = 0; k < t->n; k++) {
+      if (t->c[k] == c)
+        next = t->child[k];
+    }
+
+    if (!next) {
+      next = new_node();
+      t = &trie[node]; /* moved by realloc */
+      t->c = xrealloc(t->c, sizeof(jchar) * (t->n + 1u));
+      t->child = xrealloc(t->child, sizeof(uint32_t) * (t->n + 1u));
+      t->c[t->n] = c;
+      t->child[t->n] = next;
+      t->n++;
+    }
+
+    node = next;
+  }
+
+  trie[node].prefix |= list;
+  trie[node].term |= list;
+}
+
+/* decode a line of utf-8 (no validation: the lists are trusted). */
+static int
+decode(const unsigned char* s, jchar* out)
+{
+  int len = 0;
+
+  while (*s && len < LEN_WORD_MAX) {
+    if (*s < 0x80) {
+      out[len++] = *s;
+      s += 1;
+    } else if (*s < 0xe0 && s[1]) {
+      out[len++] = (jchar)((s[0] & 0x1f) << 6 | (s[1] & 0x3f));
+      s += 2;
+    } else if (*s < 0xf0 && s[1] && s[2]) {
+      out[len++] = (jchar)((s[0] & 0x0f) << 12 | (s[1] & 0x3f) << 6 |
+                           (s[2] & 0x3f));
+      s += 3;
+    } else if (s[1] && s[2] && s[3]) {
+      out[len++] = (jchar)((s[0] & 0x07) << 18 | (s[1] & 0x3f) << 12 |
+                           (s[2] & 0x3f) << 6 | (s[3] & 0x3f));
+      s += 4;
+    } else {
+      break;
+    }
+  }
+
+  return len;
+}
+
+static void
+read_file(const char* path, uint8_t list)
+{
+  char line[LEN_WORD_MAX * 4 + 2];
+  jchar word[LEN_WORD_MAX];
+  FILE* f = fopen(path, "r");
+
+  if (!f) {
+    fprintf(stderr, "mklexicon: cannot open %s.\n", path);
+    exit(1);
+  }
+
+  while (fgets(line, sizeof(line), f)) {
+    /* trailing spaces and newline */
+    size_t end = strlen(line);
+    while (end && (line[end - 1] == '\n' || line[end - 1] == '\r' ||
+                   line[end - 1] == ' ' || line[end - 1] == '\t'))
+      line[--end] = '\0';
+
+    if (!end || line[0] == '#')
+      continue;
+
+    add_word(word, decode((unsigned char*)line, word), list);
+  }
+
+  fclose(f);
+}
+
+/* the files of a list, separated by commas */
+static void
+read_list(const char* paths, uint8_t list)
+{
+  char* copy = xrealloc(NULL, strlen(paths) + 1);
+
+  strcpy(copy, paths);
+  for (char* path = strtok(copy, ","); path; path = strtok(NULL, ","))
+    read_file(path, list);
+
+  free(copy);
+}
+
+static int
+cmp_edge(const void* a, const void* b)
+{
+  jchar x = ((const lexedge*)a)->c;
+  jchar y = ((const lexedge*)b)->c;
+  return (x > y) - (x < y);
+}
+
+/* number the nodes breadth first, so the children of a node are
+ * contiguous in the edge array. */
+static void
+flatten(void)
+{
+  uint32_t* order = xrealloc(NULL, sizeof(uint32_t) * n_trie);
+  uint32_t* index = xrealloc(NULL, sizeof(uint32_t) * n_trie);
+  uint32_t n = 1;
+
+  order[0] = 0;
+  index[0] = 0;
+  for (uint32_t i = 0; i < n; i++) {
+    tmpnode* t = &trie[order[i]];
+    for (int k = 0; k < t->n; k++) {
+      index[t->child[k]] = n;
+      order[n++] = t->child[k];
+    }
+  }
+
+  n_nodes = n_trie;
+  nodes = xrealloc(NULL, sizeof(lexnode) * n_nodes);
+  edges = xrealloc(NULL, sizeof(lexedge) * n_nodes);
+
+  for (uint32_t i = 0; i < n_nodes; i++) {
+    tmpnode* t = &trie[order[i]];
+    nodes[i].first = n_edges;
+    nodes[i].n = t->n;
+    nodes[i].prefix = t->prefix;
+    nodes[i].term = t->term;
+    for (int k = 0; k < t->n; k++) {
+      edges[n_edges].c = t->c[k];
+      edges[n_edges].node = index[t->child[k]];
+      n_edges++;
+    }
+    qsort(&edges[nodes[i].first], t->n, sizeof(lexedge), cmp_edge);
+  }
+
+  free(order);
+  free(index);
+}
+
+static void
+print_c(void)
+{
+  printf("/* generated by tools/mklexicon.c -- do not edit. */\n\n");
+  printf("#include \"lexicon.h\"\n\n");
+
+  printf("static const lexnode nodes[%u] = {\n", n_nodes);
+  for (uint32_t i = 0; i < n_nodes; i++)
+    printf("  { %u, %u, 0x%02x, 0x%02x },\n",
+           nodes[i].first,
+           nodes[i].n,
+           nodes[i].prefix,
+           nodes[i].term);
+  printf("};\n\n");
+
+  printf("static const lexedge edges[%u] = {\n", n_edges);
+  for (uint32_t i = 0; i < n_edges; i++)
+    printf("  { 0x%04x, %u },\n", edges[i].c, edges[i].node);
+  printf("};\n\n");
+
+  printf("const TLexicon lexicon_builtin = {\n");
+  printf("  nodes,\n  edges,\n  %u,\n  %u,\n  NULL,\n  0,\n};\n",
+         n_nodes, n_edges);
+}
+
+static void
+write_file(const char* path)
+{
+  lexheader h;
+  FILE* f = fopen(path, "wb");
+
+  if (!f) {
+    fprintf(stderr, "mklexicon: cannot open %s.\n", path);
+    exit(1);
+  }
+
+  memset(&h, 0, sizeof(h));
+  memcpy(h.magic, LEX_MAGIC, sizeof(LEX_MAGIC));
+  h.version = LEX_VERSION;
+  h.byteorder = LEX_BYTEORDER;
+  h.n_nodes = n_nodes;
+  h.n_edges = n_edges;
+
+  if (fwrite(&h, sizeof(h), 1, f) != 1 ||
+      fwrite(nodes, sizeof(lexnode), n_nodes, f) != n_nodes ||
+      fwrite(edges, sizeof(lexedge), n_edges, f) != n_edges ||
+      fclose(f)) {
+    fprintf(stderr, "mklexicon: cannot write %s.\n", path);
+    exit(1);
+  }
+}
+
+int
+main(int argc, char** argv)
+{
+  static const uint8_t lists[N_LISTS] = {
+    LEX_SUFFIX,
+    LEX_INVERSION,
+    LEX_ABBREV,
+    LEX_ORDINAL,
+  };
+
+  const char* output = NULL;
+
+  if (argc > 2 && !strcmp(argv[1], "-o")) {
+    output = argv[2];
+    argc -= 2;
+    argv += 2;
+  }
+
+  if (argc != N_LISTS + 1) {
+    fputs("usage: mklexicon [-o FILE] SUFFIXES INVERSIONS "
+          "ABBREVIATIONS ORDINALS\n",
+          stderr);
+    return 1;
+  }
+
+  new_node(); /* root */
+  for (int i = 0; i < N_LISTS; i++)
+    read_list(argv[i + 1], lists[i]);
+
+  flatten();
+  if (output)
+    write_file(output);
+  else
+    print_c();
+
+  return 0;
+}
@@ -0,0 +1,252 @@
+/* mkstoptab -- compile the list of stopwords into a perfect hash table
+ * (src/stoptab.c, see src/terms.h).
+ *
+ *    ./mkstoptab ../lexicon/stopwords.txt > ../src/stoptab.c
+ *
+ * the list is a utf-8 text file, one word per line. empty lines and
+ * lines starting with '#' are ignored. words are lowercased, and the
+ * words without their diacritics are added ("été" -> "ete").
+ */
+
+#include "../src/chartab.h"
+#include "../src/terms.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define N_WORDS_MAX (STOP_SIZE / 2)
+#define SEED_MAX 0xffff
+
+static jchar words[N_WORDS_MAX][STOP_LEN_MAX];
+static int lens[N_WORDS_MAX];
+static int n_words = 0;
+
+/* the table, while it's built */
+static int slots[STOP_SIZE];
+static uint16_t seeds[STOP_BUCKETS];
+
+static void
+add_word(const jchar* word, int len)
+{
+  if (len <= 0)
+    return;
+
+  if (len > STOP_LEN_MAX) {
+    fputs("mkstoptab: word too long.\n", stderr);
+    exit(1);
+  }
+
+  for (int i = 0; i < n_words; i++) {
+    if (lens[i] == len &&
+        !memcmp(words[i], word, sizeof(jchar) * (size_t)len))
+      return;
+  }
+
+  if (n_words == N_WORDS_MAX) {
+    fputs("mkstoptab: too many words.\n", stderr);
+    exit(1);
+  }
+
+  memcpy(words[n_words], word, sizeof(jchar) * (size_t)len);
+  lens[n_words++] = len;
+}
+
+/* the word, lowercase, and without diacritics */
+static void
+add_forms(const jchar* word, int len)
+{
+  jchar lower[STOP_LEN_MAX];
+  jchar folded[STOP_LEN_MAX * 2];
+  int n = 0;
+
+  if (len > STOP_LEN_MAX) {
+    fputs("mkstoptab: word too long.\n", stderr);
+    exit(1);
+  }
+
+  for (int i = 0; i < len; i++) {
+    unsigned int fold;
+
+    lower[i] = jtowlower(word[i]);
+    fold = jch_fold(lower[i]);
+    if (fold) {
+      folded[n++] = fold & 0xff;
+      if (fold >> 8)
+        folded[n++] = fold >> 8;
+    } else
+      folded[n++] = lower[i];
+  }
+
+  add_word(lower, len);
+  add_word(folded, n);
+}
+
+static int
+decode(const unsigned char* s, jchar* out)
+{
+  int len = 0;
+
+  while (*s && len < STOP_LEN_MAX + 1) {
+    if (*s < 0x80) {
+      out[len++] = *s;
+      s += 1;
+    } else if (*s < 0xe0 && s[1]) {
+      out[len++] = (jchar)((s[0] & 0x1f) << 6 | (s[1] & 0x3f));
+      s += 2;
+    } else if (*s < 0xf0 && s[1] && s[2]) {
+      out[len++] = (jchar)((s[0] & 0x0f) << 12 | (s[1] & 0x3f) << 6 |
+                           (s[2] & 0x3f));
+      s += 3;
+    } else if (s[1] && s[2] && s[3]) {
+      out[len++] = (jchar)((s[0] & 0x07) << 18 | (s[1] & 0x3f) << 12 |
+                           (s[2] & 0x3f) << 6 | (s[3] & 0x3f));
+      s += 4;
+    } else {
+      break;
+    }
+  }
+
+  return len;
+}
+
+static void
+read_file(const char* path)
+{
+  char line[STOP_LEN_MAX * 4 + 2];
+  jchar word[STOP_LEN_MAX + 1];
+  FILE* f = fopen(path, "r");
+
+  if (!f) {
+    fprintf(stderr, "mkstoptab: cannot open %s.\n", path);
+    exit(1);
+  }
+
+  while (fgets(line, sizeof(line), f)) {
+    /* trailing spaces and newline */
+    size_t end = strlen(line);
+    while (end && (line[end - 1] == '\n' || line[end - 1] == '\r' ||
+                   line[end - 1] == ' ' || line[end - 1] == '\t'))
+      line[--end] = '\0';
+
+    if (!end || line[0] == '#')
+      continue;
+
+    add_forms(word, decode((unsigned char*)line, word));
+  }
+
+  fclose(f);
+}
+
+/* place the words of each bucket, the largest buckets first: try
+ * seeds until the words of the bucket fall in free slots (and not in
+ * the same one). */
+static void
+build(void)
+{
+  int bucket_of[N_WORDS_MAX];
+  int size[STOP_BUCKETS] = { 0 };
+  int order[STOP_BUCKETS];
+
+  for (int i = 0; i < STOP_SIZE; i++)
+    slots[i] = -1;
+
+  for (int i = 0; i < n_words; i++) {
+    bucket_of[i] = (int)(stop_hash(0, words[i], lens[i]) &
+                         (STOP_BUCKETS - 1));
+    size[bucket_of[i]]++;
+  }
+
+  for (int b = 0; b < STOP_BUCKETS; b++)
+    order[b] = b;
+  for (int i = 1; i < STOP_BUCKETS; i++) {
+    for (int j = i; j > 0 && size[order[j]] > size[order[j - 1]]; j--) {
+      int t = order[j];
+      order[j] = order[j - 1];
+      order[j - 1] = t;
+    }
+  }
+
+  for (int k = 0; k < STOP_BUCKETS; k++) {
+    int b = order[k];
+    uint32_t seed;
+
+    for (seed = 1; seed <= SEED_MAX; seed++) {
+      int placed[N_WORDS_MAX];
+      int n = 0;
+      int ok = 1;
+
+      for (int i = 0; i < n_words && ok; i++) {
+        if (bucket_of[i] != b)
+          continue;
+        uint32_t s = stop_hash(seed, words[i], lens[i]) & (STOP_SIZE - 1);
+        if (slots[s] >= 0) {
+          ok = 0;
+          break;
+        }
+        slots[s] = i;
+        placed[n++] = (int)s;
+      }
+
+      if (ok)
+        break;
+      while (n)
+        slots[placed[--n]] = -1;
+    }
+
+    if (seed > SEED_MAX) {
+      fputs("mkstoptab: no perfect hash found.\n", stderr);
+      exit(1);
+    }
+    seeds[b] = (uint16_t)seed;
+  }
+}
+
+static void
+print_c(void)
+{
+  int first[N_WORDS_MAX];
+  int n_chars = 0;
+
+  printf("/* generated by tools/mkstoptab.c -- do not edit. */\n\n");
+  printf("#include \"terms.h\"\n\n");
+
+  printf("const uint16_t stop_seeds[STOP_BUCKETS] = {");
+  for (int b = 0; b < STOP_BUCKETS; b++)
+    printf("%s%5u,", (b % 10) ? " " : "\n  ", seeds[b]);
+  printf("\n};\n\n");
+
+  printf("const jchar stop_chars[] = {\n");
+  for (int i = 0; i < n_words; i++) {
+    first[i] = n_chars;
+    printf(" ");
+    for (int k = 0; k < lens[i]; k++)
+      printf(" 0x%02x,", words[i][k]);
+    printf("\n");
+    n_chars += lens[i];
+  }
+  printf("};\n\n");
+
+  printf("const stopslot stop_slots[STOP_SIZE] = {\n");
+  for (int s = 0; s < STOP_SIZE; s++) {
+    if (slots[s] >= 0)
+      printf("  { %d, %d },\n", first[slots[s]], lens[slots[s]]);
+    else
+      printf("  { 0, 0 },\n");
+  }
+  printf("};\n");
+}
+
+int
+main(int argc, char** argv)
+{
+  if (argc != 2) {
+    fputs("usage: mkstoptab stopwords.txt > stoptab.c\n", stderr);
+    return 1;
+  }
+
+  read_file(argv[1]);
+  build();
+  print_c();
+
+  return 0;
+}